@@ -0,0 +1,164 @@
+#include "bench_utils.h"
+
+#include "utils/array_utils.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+// Replays the split loop nest of the MIF DPs, max over q of forest(v, q, R) + forest(w, p + 1, q - 1), on a random
+// n x 2n x 2n table stored in each layout. Reports the wall time and the misses of a simulated 32 KiB, 8-way, 64-byte
+// line LRU L1 data cache fed with the cell addresses, which is what the layouts change.
+namespace
+{
+    class CacheModel
+    {
+    public:
+        void access(const void *address)
+        {
+            const auto line = reinterpret_cast<std::uintptr_t>(address) / lineBytes;
+            auto &set = _sets[line % setCount];
+            ++_accesses;
+            for (std::size_t way = 0; way < ways; ++way)
+            {
+                if (set[way] == line)
+                {
+                    for (; way > 0; --way)
+                    {
+                        set[way] = set[way - 1];
+                    }
+                    set[0] = line;
+                    return;
+                }
+            }
+            ++_misses;
+            for (auto way = ways - 1; way > 0; --way)
+            {
+                set[way] = set[way - 1];
+            }
+            set[0] = line;
+        }
+
+        [[nodiscard]] double missRate() const { return _accesses == 0 ? 0.0 : static_cast<double>(_misses) / _accesses; }
+
+    private:
+        static constexpr std::size_t lineBytes = 64;
+        static constexpr std::size_t ways = 8;
+        static constexpr std::size_t setCount = 32 * 1024 / lineBytes / ways;
+
+        std::vector<std::array<std::uintptr_t, ways>> _sets = std::vector<std::array<std::uintptr_t, ways>>(setCount, std::array<std::uintptr_t, ways>{});
+        std::uint64_t _accesses = 0;
+        std::uint64_t _misses = 0;
+    };
+
+    struct Workload
+    {
+        int n = 0;
+        int M = 0;
+        // (w, v, e, R): root w, child v, root endpoint e with lv < e < rv, right end R.
+        std::vector<std::array<int, 6>> splits;
+    };
+
+    Workload makeWorkload(int n, int seed)
+    {
+        std::mt19937 rng(seed);
+        Workload workload{n, 2 * n, {}};
+        std::uniform_int_distribution<int> point(0, workload.M - 1);
+        for (auto s = 0; s < 4 * n * n; ++s)
+        {
+            auto lv = point(rng);
+            auto rv = point(rng);
+            if (lv > rv)
+            {
+                std::swap(lv, rv);
+            }
+            if (rv - lv < 2)
+            {
+                continue;
+            }
+            const auto e = lv + 1 + static_cast<int>(rng() % (rv - lv - 1));
+            const auto R = rv + static_cast<int>(rng() % (workload.M - rv));
+            workload.splits.push_back({static_cast<int>(rng() % n), static_cast<int>(rng() % n), lv, e, rv, R});
+        }
+        return workload;
+    }
+
+    template <class Table>
+    long runSplits(const Table &forest, const Workload &workload, CacheModel *cache)
+    {
+        long total = 0;
+        for (const auto &[w, v, lv, e, rv, R] : workload.splits)
+        {
+            for (auto p = lv; p < e; ++p)
+            {
+                auto best = 0;
+                for (auto q = e + 1; q <= rv; ++q)
+                {
+                    auto middle = 0;
+                    if (p + 1 <= q - 1)
+                    {
+                        middle = forest(w, p + 1, q - 1);
+                        if (cache)
+                        {
+                            cache->access(&forest(w, p + 1, q - 1));
+                        }
+                    }
+                    const auto score = forest(v, q, R) + middle;
+                    if (cache)
+                    {
+                        cache->access(&forest(v, q, R));
+                    }
+                    best = std::max(best, score);
+                }
+                total += best;
+            }
+        }
+        return total;
+    }
+
+    template <class Table>
+    void report(const std::string &name, const Workload &workload)
+    {
+        Table forest(workload.n, workload.M, workload.M, 0);
+        std::mt19937 rng(17);
+        for (auto i = 0; i < workload.n; ++i)
+        {
+            for (auto j = 0; j < workload.M; ++j)
+            {
+                for (auto k = 0; k < workload.M; ++k)
+                {
+                    forest(i, j, k) = static_cast<int>(rng() % 8);
+                }
+            }
+        }
+        CacheModel cache;
+        const auto checksum = runSplits(forest, workload, &cache);
+        const auto ms = cg::bench::bestOfMs(3, [&]
+        {
+            cg::bench::doNotOptimize(runSplits(forest, workload, nullptr));
+        });
+        cg::bench::printRow(name, workload.n, ms);
+        std::cout << "    simulated L1 miss rate " << std::fixed << std::setprecision(3) << cache.missRate() << ", checksum " << checksum << "\n";
+    }
+}
+
+int main()
+{
+    using cg::utils::DimOrder;
+    for (auto n : {60, 120, 200})
+    {
+        const auto workload = makeWorkload(n, 99 + n);
+        report<cg::utils::array3<int>>("array3 (row-major)", workload);
+        report<cg::utils::tiled_array3<int, DimOrder::IJK, 0>>("tiled_array3<IJK, 0>", workload);
+        report<cg::utils::tiled_array3<int, DimOrder::IJK, 3>>("tiled_array3<IJK, 3>", workload);
+        report<cg::utils::tiled_array3<int, DimOrder::IJK, 4>>("tiled_array3<IJK, 4>", workload);
+        report<cg::utils::tiled_array3<int, DimOrder::IKJ, 0>>("tiled_array3<IKJ, 0>", workload);
+        report<cg::utils::tiled_array3<int, DimOrder::IKJ, 3>>("tiled_array3<IKJ, 3>", workload);
+    }
+    return 0;
+}
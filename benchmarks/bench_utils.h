@@ -0,0 +1,38 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <string_view>
+
+namespace cg::bench
+{
+    // Keeps a value alive so the optimiser cannot discard the work that produced it.
+    template <typename T>
+    inline void doNotOptimize(const T &value)
+    {
+        asm volatile("" : : "r,m"(value) : "memory");
+    }
+
+    // Runs f() 'repetitions' times and returns the fastest run in milliseconds.
+    template <typename F>
+    double bestOfMs(int repetitions, F &&f)
+    {
+        auto best = std::numeric_limits<double>::max();
+        for (auto i = 0; i < repetitions; ++i)
+        {
+            const auto start = std::chrono::steady_clock::now();
+            f();
+            const auto stop = std::chrono::steady_clock::now();
+            best = std::min(best, std::chrono::duration<double, std::milli>(stop - start).count());
+        }
+        return best;
+    }
+
+    inline void printRow(std::string_view name, long n, double ms, std::ostream &out = std::cout)
+    {
+        out << std::left << std::setw(48) << name << std::right << std::setw(12) << n << std::setw(14) << std::fixed << std::setprecision(3) << ms << " ms\n";
+    }
+}
@@ -0,0 +1,89 @@
+#include "bench_utils.h"
+
+#include "data_structures/csr_graph.h"
+#include "data_structures/interval.h"
+#include "data_structures/distinct_interval_model.h"
+#include "utils/interval_model_utils.h"
+#include "utils/thread_pool.h"
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+// Times building the circle graph of a model with pairwise Interval::overlaps tests fed to CsrGraph::Builder against
+// the end-point sweep of CsrGraph::fromIntervalModel, on dense random models and on sparse ones made of many small
+// random blocks side by side (about 3 edges per interval).
+namespace
+{
+    std::vector<cg::data_structures::Interval> sparseIntervals(int n, int blockSize)
+    {
+        std::vector<cg::data_structures::Interval> intervals;
+        for (auto block = 0; block * blockSize < n; ++block)
+        {
+            const auto offset = static_cast<int>(2 * intervals.size());
+            for (const auto &interval : cg::interval_model_utils::generateRandomIntervals(blockSize, 9 + block))
+            {
+                intervals.emplace_back(interval.Left + offset, interval.Right + offset, static_cast<int>(intervals.size()), 1);
+            }
+        }
+        return intervals;
+    }
+
+    void compare(const std::string &name, const std::vector<cg::data_structures::Interval> &intervals, const std::vector<int> &threadCounts)
+    {
+        const auto n = static_cast<int>(intervals.size());
+        const cg::data_structures::DistinctIntervalModel model(intervals);
+
+        std::size_t pairwiseEdges = 0;
+        const auto pairwiseMs = cg::bench::bestOfMs(1, [&]
+        {
+            cg::data_structures::CsrGraph::Builder builder(n);
+            for (auto i = 0; i < n; ++i)
+            {
+                for (auto j = i + 1; j < n; ++j)
+                {
+                    if (intervals[i].overlaps(intervals[j]))
+                    {
+                        builder.addEdge(intervals[i].Index, intervals[j].Index);
+                    }
+                }
+            }
+            pairwiseEdges = builder.build().numEdgeEnds() / 2;
+        });
+        std::cout << name << ", " << pairwiseEdges << " edges\n";
+        cg::bench::printRow("pairwise overlaps + Builder", n, pairwiseMs);
+
+        for (auto threadCount : threadCounts)
+        {
+            std::size_t sweepEdges = 0;
+            const auto sweepMs = cg::bench::bestOfMs(3, [&]
+            {
+                sweepEdges = cg::data_structures::CsrGraph::fromIntervalModel(model, threadCount).numEdgeEnds() / 2;
+            });
+            if (sweepEdges != pairwiseEdges)
+            {
+                std::cerr << "edge count mismatch: " << sweepEdges << " != " << pairwiseEdges << "\n";
+            }
+            cg::bench::printRow("fromIntervalModel, threads=" + std::to_string(threadCount), n, sweepMs);
+        }
+    }
+}
+
+int main()
+{
+    const auto hardwareThreads = cg::utils::ThreadPool::resolveThreadCount(0);
+    std::vector<int> threadCounts{1};
+    if (hardwareThreads > 1)
+    {
+        threadCounts.push_back(hardwareThreads);
+    }
+    for (auto n : {1000, 2000, 4000})
+    {
+        compare("dense random", cg::interval_model_utils::generateRandomIntervals(n, 5 + n), threadCounts);
+    }
+    for (auto n : {10000, 40000})
+    {
+        compare("sparse blocks of 10", sparseIntervals(n, 10), threadCounts);
+    }
+    return 0;
+}
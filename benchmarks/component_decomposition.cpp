@@ -0,0 +1,82 @@
+#include "bench_utils.h"
+
+#include "data_structures/interval.h"
+#include "data_structures/distinct_interval_model.h"
+#include "mif/mif_rscan_n5_qspace.h"
+#include "utils/component_decomposition.h"
+#include "utils/interval_model_utils.h"
+#include "utils/thread_pool.h"
+
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+// Times MifRscanN5Qspace on a disconnected model, once on the whole model and once through the component driver on
+// one thread and on all hardware threads. The model is built from random pieces dropped into random gaps of each
+// other, so its graph has (at least) one component per piece.
+namespace
+{
+    std::vector<cg::data_structures::Interval> disconnectedIntervals(int pieces, int pieceSize, int seed)
+    {
+        std::mt19937 rng(seed);
+        std::vector<cg::data_structures::Interval> intervals;
+        for (auto piece = 0; piece < pieces; ++piece)
+        {
+            const auto gap = static_cast<int>(rng() % (2 * intervals.size() + 1));
+            for (auto &interval : intervals)
+            {
+                interval.Left += interval.Left >= gap ? 2 * pieceSize : 0;
+                interval.Right += interval.Right >= gap ? 2 * pieceSize : 0;
+            }
+            for (const auto &interval : cg::interval_model_utils::generateRandomIntervals(pieceSize, static_cast<int>(rng())))
+            {
+                intervals.emplace_back(interval.Left + gap, interval.Right + gap, static_cast<int>(intervals.size()), 1);
+            }
+        }
+        return intervals;
+    }
+}
+
+int main()
+{
+    const auto hardwareThreads = cg::utils::ThreadPool::resolveThreadCount(0);
+    std::vector<int> threadCounts{1};
+    if (hardwareThreads > 1)
+    {
+        threadCounts.push_back(hardwareThreads);
+    }
+    for (auto pieces : {4, 8})
+    {
+        const auto pieceSize = 15;
+        const cg::data_structures::DistinctIntervalModel model(disconnectedIntervals(pieces, pieceSize, 77 + pieces));
+        const auto n = model.size;
+        std::cout << pieces << " pieces of " << pieceSize << ": " << cg::components::decompose(model).size() << " components\n";
+
+        int whole = 0;
+        const auto wholeMs = cg::bench::bestOfMs(3, [&]
+        {
+            whole = cg::mif::MifRscanN5Qspace::computeMifSize(model);
+        });
+        cg::bench::printRow("whole model", n, wholeMs);
+
+        for (auto threadCount : threadCounts)
+        {
+            long long split = 0;
+            const auto splitMs = cg::bench::bestOfMs(3, [&]
+            {
+                split = cg::components::sumPerComponent(model, threadCount, [](const auto &component)
+                {
+                    return cg::mif::MifRscanN5Qspace::computeMifSize(component);
+                });
+            });
+            if (split != whole)
+            {
+                std::cerr << "size mismatch: " << split << " != " << whole << "\n";
+                return 1;
+            }
+            cg::bench::printRow("per component, threads=" + std::to_string(threadCount), n, splitMs);
+        }
+    }
+    return 0;
+}
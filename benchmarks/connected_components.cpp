@@ -0,0 +1,81 @@
+#include "bench_utils.h"
+
+#include "data_structures/interval.h"
+#include "utils/components.h"
+#include "utils/interval_model_utils.h"
+
+#include <algorithm>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+// Times the three connected component algorithms: the O(n^2) naive one (small n only), the small-to-large merge of
+// red-black trees in getConnectedComponents, and the union-find sweep in getConnectedComponentLabels. Uniformly random
+// models are a single giant component; "local" models pair end-points within short windows and have many small ones.
+namespace
+{
+    std::vector<cg::data_structures::Interval> localIntervals(int n, int window, int seed)
+    {
+        std::vector<int> endpoints(2 * n);
+        std::iota(endpoints.begin(), endpoints.end(), 0);
+        std::mt19937 rng(seed);
+        for (auto begin = 0; begin < 2 * n; begin += 2 * window)
+        {
+            std::shuffle(endpoints.begin() + begin, endpoints.begin() + std::min(2 * n, begin + 2 * window), rng);
+        }
+        std::vector<cg::data_structures::Interval> intervals;
+        intervals.reserve(n);
+        for (auto i = 0; i < n; ++i)
+        {
+            intervals.emplace_back(std::min(endpoints[2 * i], endpoints[2 * i + 1]), std::max(endpoints[2 * i], endpoints[2 * i + 1]), i, 1);
+        }
+        return intervals;
+    }
+
+    void run(const std::string &name, const std::vector<cg::data_structures::Interval> &intervals, bool withNaive, bool withSets)
+    {
+        const auto n = static_cast<long>(intervals.size());
+        const auto labelMs = cg::bench::bestOfMs(3, [&]
+        {
+            cg::bench::doNotOptimize(cg::components::getConnectedComponentLabels(intervals).numComponents);
+        });
+        const auto numComponents = cg::components::getConnectedComponentLabels(intervals).numComponents;
+        std::cout << name << ": " << numComponents << " components\n";
+        cg::bench::printRow("  union-find labels", n, labelMs);
+        if (withSets)
+        {
+            std::size_t count = 0;
+            const auto setMs = cg::bench::bestOfMs(1, [&]
+            {
+                count = cg::components::getConnectedComponents(intervals).size();
+            });
+            if (count != static_cast<std::size_t>(numComponents))
+            {
+                std::cerr << "component count mismatch: " << count << " != " << numComponents << "\n";
+            }
+            cg::bench::printRow("  small-to-large sets", n, setMs);
+        }
+        if (withNaive)
+        {
+            const auto naiveMs = cg::bench::bestOfMs(1, [&]
+            {
+                cg::bench::doNotOptimize(cg::components::getConnectedComponentsNaive(intervals).size());
+            });
+            cg::bench::printRow("  naive", n, naiveMs);
+        }
+    }
+}
+
+int main()
+{
+    for (auto n : {1'000, 10'000, 100'000, 1'000'000, 10'000'000})
+    {
+        const auto withNaive = n <= 10'000;
+        const auto withSets = n <= 1'000'000;
+        run("random, n=" + std::to_string(n), cg::interval_model_utils::generateRandomIntervals(n, 7 + n), withNaive, withSets);
+        run("local, n=" + std::to_string(n), localIntervals(n, 8, 11 + n), withNaive, withSets);
+    }
+    return 0;
+}
@@ -0,0 +1,124 @@
+#include "bench_utils.h"
+
+#include "data_structures/csr_graph.h"
+#include "data_structures/graph.h"
+#include "data_structures/interval.h"
+#include "utils/interval_model_utils.h"
+#include "utils/spinrad_prime.h"
+
+#include <cstddef>
+#include <iostream>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Compares the hash-set Graph with the CSR backend on dense circle graphs (overlap graphs of random interval models):
+// memory, construction, a full neighbour scan, random adjacency tests and SpinradPrime::trySplit.
+namespace
+{
+    // libstdc++ unordered_set<int>: one 16-byte node per element plus allocator overhead (counted as 16 bytes), one
+    // pointer per bucket, and the set object itself.
+    std::size_t approximateGraphBytes(const cg::data_structures::Graph &g)
+    {
+        auto bytes = static_cast<std::size_t>(g.numVertices()) * sizeof(cg::data_structures::Graph::Neighbours);
+        for (auto v = 0; v < g.numVertices(); ++v)
+        {
+            bytes += g.neighbours(v).bucket_count() * sizeof(void *) + g.neighbours(v).size() * 32;
+        }
+        return bytes;
+    }
+
+    template <class TGraph>
+    long scanNeighbours(const TGraph &g)
+    {
+        long total = 0;
+        for (auto v = 0; v < g.numVertices(); ++v)
+        {
+            for (auto w : g.neighbours(v))
+            {
+                total += w;
+            }
+        }
+        return total;
+    }
+
+    template <class TGraph>
+    int countAdjacent(const TGraph &g, const std::vector<std::pair<int, int>> &queries)
+    {
+        auto count = 0;
+        for (const auto &[u, v] : queries)
+        {
+            count += g.hasEdge(u, v) ? 1 : 0;
+        }
+        return count;
+    }
+}
+
+int main()
+{
+    for (auto n : {500, 1000, 1500})
+    {
+        const auto intervals = cg::interval_model_utils::generateRandomIntervals(n, 31 + n);
+        std::vector<std::pair<int, int>> edges;
+        for (auto i = 0; i < n; ++i)
+        {
+            for (auto j = i + 1; j < n; ++j)
+            {
+                if (intervals[i].overlaps(intervals[j]))
+                {
+                    edges.emplace_back(i, j);
+                }
+            }
+        }
+        std::cout << "n = " << n << ", " << edges.size() << " edges\n";
+
+        cg::data_structures::Graph graph(n);
+        const auto graphBuildMs = cg::bench::bestOfMs(1, [&]
+        {
+            for (const auto &[u, v] : edges)
+            {
+                graph.addEdge(u, v);
+            }
+        });
+        cg::bench::printRow("Graph build", n, graphBuildMs);
+
+        cg::data_structures::CsrGraph csr(graph);
+        const auto csrBuildMs = cg::bench::bestOfMs(3, [&]
+        {
+            cg::data_structures::CsrGraph::Builder builder(n);
+            builder.reserve(edges.size());
+            for (const auto &[u, v] : edges)
+            {
+                builder.addEdge(u, v);
+            }
+            csr = builder.build();
+        });
+        cg::bench::printRow("CsrGraph::Builder build", n, csrBuildMs);
+        std::cout << "  memory: Graph ~" << approximateGraphBytes(graph) / 1024 << " KiB, CsrGraph " << csr.memoryBytes() / 1024 << " KiB\n";
+
+        cg::bench::printRow("Graph neighbour scan", n, cg::bench::bestOfMs(5, [&] { cg::bench::doNotOptimize(scanNeighbours(graph)); }));
+        cg::bench::printRow("CsrGraph neighbour scan", n, cg::bench::bestOfMs(5, [&] { cg::bench::doNotOptimize(scanNeighbours(csr)); }));
+
+        std::mt19937 rng(n);
+        std::vector<std::pair<int, int>> queries(1'000'000);
+        for (auto &query : queries)
+        {
+            query = {static_cast<int>(rng() % n), static_cast<int>(rng() % n)};
+        }
+        cg::bench::printRow("Graph hasEdge x1e6", n, cg::bench::bestOfMs(3, [&] { cg::bench::doNotOptimize(countAdjacent(graph, queries)); }));
+        cg::bench::printRow("CsrGraph hasEdge x1e6", n, cg::bench::bestOfMs(3, [&] { cg::bench::doNotOptimize(countAdjacent(csr, queries)); }));
+
+        cg::utils::SpinradPrime sp;
+        bool graphSplit = false;
+        bool csrSplit = false;
+        cg::bench::printRow("SpinradPrime::trySplit on Graph", n, cg::bench::bestOfMs(1, [&] { graphSplit = sp.trySplit(graph).has_value(); }));
+        cg::bench::printRow("SpinradPrime::trySplit on CsrGraph", n, cg::bench::bestOfMs(1, [&] { csrSplit = sp.trySplit(csr).has_value(); }));
+        if (graphSplit != csrSplit)
+        {
+            std::cerr << "split mismatch\n";
+            return 1;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,95 @@
+#include "bench_utils.h"
+
+#include "utils/fenwick_max.h"
+#include "utils/fast_fenwick_max.h"
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+// Compares the checked FenwickMax against FastFenwickMax: building from an array (n point updates versus the O(n)
+// build), interleaved point updates and queries, and n queries answered one by one versus as a sorted batch.
+namespace
+{
+    std::vector<int> randomValues(int n, int maxValue, int seed)
+    {
+        std::mt19937 rng(seed);
+        std::uniform_int_distribution<int> value(0, maxValue);
+        std::vector<int> values(n);
+        for (auto &v : values)
+        {
+            v = value(rng);
+        }
+        return values;
+    }
+
+    template <typename TFenwick>
+    long interleaved(int n, const std::vector<int> &indices, const std::vector<int> &values)
+    {
+        TFenwick fenwick(n, 0);
+        long sum = 0;
+        for (size_t k = 0; k < indices.size(); ++k)
+        {
+            fenwick.setIdx(indices[k], values[k]);
+            sum += fenwick.prefixMaxInclusive(indices[indices.size() - 1 - k]);
+        }
+        return sum;
+    }
+
+    template <typename TFenwick>
+    long oneByOne(const TFenwick &fenwick, const std::vector<int> &queries)
+    {
+        long sum = 0;
+        for (auto q : queries)
+        {
+            sum += fenwick.prefixMaxInclusive(q);
+        }
+        return sum;
+    }
+}
+
+int main()
+{
+    constexpr int repetitions = 5;
+    for (auto n : {100000, 1000000, 10000000})
+    {
+        const auto values = randomValues(n, 1 << 30, 1);
+        const auto indices = randomValues(n, n - 1, 2);
+        auto sortedQueries = randomValues(n, n - 1, 3);
+        std::sort(sortedQueries.begin(), sortedQueries.end());
+
+        cg::bench::printRow("build FenwickMax (n setIdx)", n, cg::bench::bestOfMs(repetitions, [&] {
+            cg::utils::FenwickMax fenwick(n);
+            for (auto i = 0; i < n; ++i)
+            {
+                fenwick.setIdx(i, values[i]);
+            }
+            cg::bench::doNotOptimize(fenwick.prefixMaxInclusive(n - 1));
+        }));
+        cg::bench::printRow("build FastFenwickMax (build)", n, cg::bench::bestOfMs(repetitions, [&] {
+            cg::utils::FastFenwickMax fenwick(n);
+            fenwick.build(values);
+            cg::bench::doNotOptimize(fenwick.prefixMaxInclusive(n - 1));
+        }));
+
+        cg::bench::printRow("interleaved FenwickMax", n, cg::bench::bestOfMs(repetitions, [&] { cg::bench::doNotOptimize(interleaved<cg::utils::FenwickMax>(n, indices, values)); }));
+        cg::bench::printRow("interleaved FastFenwickMax", n, cg::bench::bestOfMs(repetitions, [&] { cg::bench::doNotOptimize(interleaved<cg::utils::FastFenwickMax>(n, indices, values)); }));
+
+        cg::utils::FenwickMax checked(n);
+        cg::utils::FastFenwickMax fast(n);
+        fast.build(values);
+        for (auto i = 0; i < n; ++i)
+        {
+            checked.setIdx(i, values[i]);
+        }
+        std::vector<int> results(n);
+        cg::bench::printRow("sorted queries FenwickMax", n, cg::bench::bestOfMs(repetitions, [&] { cg::bench::doNotOptimize(oneByOne(checked, sortedQueries)); }));
+        cg::bench::printRow("sorted queries FastFenwickMax", n, cg::bench::bestOfMs(repetitions, [&] { cg::bench::doNotOptimize(oneByOne(fast, sortedQueries)); }));
+        cg::bench::printRow("sorted queries FastFenwickMax batched", n, cg::bench::bestOfMs(repetitions, [&] {
+            fast.prefixMaxInclusive(sortedQueries, results);
+            cg::bench::doNotOptimize(results.back());
+        }));
+    }
+    return 0;
+}
@@ -0,0 +1,62 @@
+#include "bench_utils.h"
+
+#include "data_structures/interval.h"
+#include "mif/gavril.h"
+#include "utils/interval_model_utils.h"
+
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Reports the peak memory of Gavril's DP tables, stored per layer in hash maps, next to what the dense array3/array4
+// tables would allocate for the same input, with every layer kept and with only the rolling window of score layers
+// kept. The inputs are nested chains (one layer per interval), as in tests/mif/gavril_tests.cpp, and random models
+// from interval_model_utils::generateRandomIntervals.
+namespace
+{
+    std::vector<cg::data_structures::Interval> nestedChain(int n)
+    {
+        std::vector<cg::data_structures::Interval> intervals;
+        for (auto i = 0; i < n; ++i)
+        {
+            intervals.emplace_back(i, 2 * n - 1 - i, i, 1);
+        }
+        return intervals;
+    }
+
+    void report(const std::string &name, const std::vector<cg::data_structures::Interval> &intervals, cg::mif::Gavril::LayerRetention retention)
+    {
+        cg::mif::Gavril::TableStats stats;
+        const auto ms = cg::bench::bestOfMs(1, [&]
+        {
+            try
+            {
+                cg::bench::doNotOptimize(cg::mif::Gavril::computeMif(intervals, stats, retention).size());
+            }
+            catch (const std::exception &)
+            {
+                // Known reconstruction failures still leave the tables fully built.
+            }
+        });
+        cg::bench::printRow(name, static_cast<long>(intervals.size()), ms);
+        std::cout << "    entries " << stats.storedEntries
+                  << ", sparse " << std::fixed << std::setprecision(1) << stats.memoryBytes / 1024.0 << " KiB"
+                  << ", dense " << stats.denseBytes / 1024.0 << " KiB\n";
+    }
+}
+
+int main()
+{
+    for (auto n : {3, 4, 8, 16, 24})
+    {
+        for (const auto &[label, retention] : {std::pair{"all layers", cg::mif::Gavril::LayerRetention::AllLayers},
+                                               std::pair{"rolling layers", cg::mif::Gavril::LayerRetention::RollingLayers}})
+        {
+            report(std::string("nested chain, ") + label, nestedChain(n), retention);
+            report(std::string("generateRandomIntervals, ") + label, cg::interval_model_utils::generateRandomIntervals(n, 1234567 + n), retention);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,98 @@
+#include "bench_utils.h"
+
+#include "data_structures/interval.h"
+#include "data_structures/shared_interval_model.h"
+#include "mis/shared/naive.h"
+#include "mis/shared/valiente.h"
+#include "mis/shared/pure_output_sensitive.h"
+#include "mis/shared/pruned_output_sensitive.h"
+#include "utils/counters.h"
+#include "utils/interval_model_utils.h"
+
+#include <cstdlib>
+#include <limits>
+#include <new>
+#include <string>
+
+// Counts heap allocations made while walking the end-point buckets of a SharedIntervalModel the way shared::Valiente
+// does, once through the by-value accessors and once through the std::span views, and reports the allocations made
+// by each shared MIS solver end-to-end.
+namespace
+{
+    long numAllocations = 0;
+}
+
+void *operator new(std::size_t size)
+{
+    ++numAllocations;
+    if (auto *p = std::malloc(size == 0 ? 1 : size))
+    {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void *p) noexcept { std::free(p); }
+void operator delete(void *p, std::size_t) noexcept { std::free(p); }
+
+namespace
+{
+    template <typename F>
+    void measure(const std::string &name, int n, F &&f)
+    {
+        const auto before = numAllocations;
+        const auto ms = cg::bench::bestOfMs(1, f);
+        cg::bench::printRow(name + " (" + std::to_string(numAllocations - before) + " allocations)", n, ms);
+    }
+
+    // The access pattern of shared::Valiente::computeMIS: for every right end-point, visit every left end-point bucket
+    // strictly inside the longest interval ending there.
+    template <typename TGetBucket>
+    long valienteSweep(const cg::data_structures::SharedIntervalModel &model, TGetBucket &&getBucket)
+    {
+        long sum = 0;
+        for (auto right = 0; right < model.end; ++right)
+        {
+            const auto rightIntervals = model.intervalsWithRightEndpoint(right);
+            if (rightIntervals.empty())
+            {
+                continue;
+            }
+            const auto &longest = rightIntervals[0];
+            for (auto here = longest.Right - 1; here > longest.Left; --here)
+            {
+                const auto &bucket = getBucket(here);
+                for (const auto &interval : bucket)
+                {
+                    sum += interval.Index;
+                }
+            }
+        }
+        return sum;
+    }
+
+    void run(int numIntervals)
+    {
+        const auto intervals = cg::interval_model_utils::generateRandomIntervalsShared(numIntervals, 4, numIntervals / 4, 42);
+        const cg::data_structures::SharedIntervalModel model(intervals);
+        const auto n = model.size;
+
+        measure("valiente sweep/by-value", n, [&] { cg::bench::doNotOptimize(valienteSweep(model, [&](int e) { return model.getAllIntervalsWithLeftEndpoint(e); })); });
+        measure("valiente sweep/span", n, [&] { cg::bench::doNotOptimize(valienteSweep(model, [&](int e) { return model.intervalsWithLeftEndpoint(e); })); });
+
+        constexpr auto maxAllowed = std::numeric_limits<int>::max();
+        measure("shared::Naive", n, [&] { cg::utils::Counters<cg::mis::shared::Naive::Counts> c; cg::bench::doNotOptimize(cg::mis::shared::Naive::computeMIS(model, c).size()); });
+        measure("shared::Valiente", n, [&] { cg::utils::Counters<cg::mis::shared::Valiente::Counts> c; cg::bench::doNotOptimize(cg::mis::shared::Valiente::computeMIS(model, c).size()); });
+        measure("shared::PureOutputSensitive", n, [&] { cg::utils::Counters<cg::mis::shared::PureOutputSensitive::Counts> c; cg::bench::doNotOptimize(cg::mis::shared::PureOutputSensitive::tryComputeMIS(model, maxAllowed, c)->size()); });
+        measure("shared::PrunedOutputSensitive", n, [&] { cg::utils::Counters<cg::mis::shared::PrunedOutputSensitive::Counts> c; cg::bench::doNotOptimize(cg::mis::shared::PrunedOutputSensitive::tryComputeMIS(model, maxAllowed, c)->size()); });
+    }
+}
+
+int main()
+{
+    for (auto numIntervals : {1000, 4000})
+    {
+        run(numIntervals);
+    }
+    return 0;
+}
@@ -0,0 +1,104 @@
+#include "bench_utils.h"
+
+#include "data_structures/interval.h"
+#include "data_structures/distinct_interval_model.h"
+#include "mif/mif_rscan_n5_qspace.h"
+#include "mif/nick_simpler_mif.h"
+#include "utils/interval_model_utils.h"
+#include "utils/max_plus.h"
+
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+// Times the max-plus kernels at every SIMD level this machine supports, first on their own over row lengths typical
+// of the MIF B cells, then inside NickSimplerMif and MifRscanN5Qspace.
+namespace
+{
+    const char *levelName(cg::utils::SimdLevel level)
+    {
+        switch (level)
+        {
+        case cg::utils::SimdLevel::Scalar:
+            return "scalar";
+        case cg::utils::SimdLevel::Sse41:
+            return "sse4.1";
+        case cg::utils::SimdLevel::Avx2:
+            return "avx2";
+        case cg::utils::SimdLevel::Avx512:
+            return "avx512";
+        }
+        return "?";
+    }
+
+    template <class T>
+    void kernelRows(const std::string &typeName, cg::utils::SimdLevel level)
+    {
+        std::mt19937 rng(7);
+        for (auto count : {16, 64, 256})
+        {
+            constexpr auto rows = 4096;
+            std::vector<T> a(static_cast<std::size_t>(rows) * count);
+            std::vector<T> b(a.size());
+            for (auto i = std::size_t{0}; i < a.size(); ++i)
+            {
+                a[i] = static_cast<T>(rng() % 100);
+                b[i] = static_cast<T>(rng() % 100);
+            }
+            const auto ms = cg::bench::bestOfMs(5, [&]
+            {
+                long total = 0;
+                for (auto r = 0; r < rows; ++r)
+                {
+                    total += cg::utils::argMaxPlus(a.data() + r * count, b.data() + r * count, count).index;
+                }
+                cg::bench::doNotOptimize(total);
+            });
+            cg::bench::printRow(std::string("argMaxPlus<") + typeName + ">, " + levelName(level) + ", 4096 rows", count, ms);
+        }
+    }
+}
+
+int main()
+{
+    const auto supported = cg::utils::supportedSimdLevel();
+    std::vector<cg::utils::SimdLevel> levels;
+    for (auto level : {cg::utils::SimdLevel::Scalar, cg::utils::SimdLevel::Sse41, cg::utils::SimdLevel::Avx2, cg::utils::SimdLevel::Avx512})
+    {
+        if (level <= supported)
+        {
+            levels.push_back(level);
+        }
+    }
+
+    for (auto level : levels)
+    {
+        cg::utils::setSimdLevel(level);
+        kernelRows<std::uint8_t>("uint8", level);
+        kernelRows<std::uint16_t>("uint16", level);
+        kernelRows<int>("int", level);
+    }
+
+    for (auto n : {60, 100})
+    {
+        const cg::data_structures::DistinctIntervalModel model(cg::interval_model_utils::generateRandomIntervals(n, 4242 + n));
+        for (auto level : levels)
+        {
+            cg::utils::setSimdLevel(level);
+            const auto nickMs = cg::bench::bestOfMs(3, [&]
+            {
+                cg::bench::doNotOptimize(cg::mif::NickSimplerMif::computeMif(model).first);
+            });
+            cg::bench::printRow(std::string("NickSimplerMif::computeMif, ") + levelName(level), n, nickMs);
+            const auto rscanMs = cg::bench::bestOfMs(3, [&]
+            {
+                cg::bench::doNotOptimize(cg::mif::MifRscanN5Qspace::computeMif(model).first);
+            });
+            cg::bench::printRow(std::string("MifRscanN5Qspace::computeMif, ") + levelName(level), n, rscanMs);
+        }
+    }
+    cg::utils::setSimdLevel(supported);
+    return 0;
+}
@@ -0,0 +1,59 @@
+#include "bench_utils.h"
+
+#include "data_structures/interval.h"
+#include "data_structures/distinct_interval_model.h"
+#include "mif/interval_candidates.h"
+#include "mif/mif_rscan_n5_qspace.h"
+#include "mif/nick_simpler_mif.h"
+#include "utils/interval_model_utils.h"
+
+#include <iostream>
+#include <string>
+
+// Times the two O(n^5)-style MIF DPs with children enumerated from IntervalCandidates against the full scan over all n
+// intervals per cell they replaced, and reports how long the candidate lists are on average compared with n: the ratio
+// is the fraction of the full scan's inner-loop iterations that survive the pruning.
+namespace
+{
+    template <typename FSize>
+    void compare(const std::string &name, long n, FSize &&computeSize)
+    {
+        cg::mif::setCandidatePruning(false);
+        const auto fullSize = computeSize();
+        cg::bench::printRow(name + "/full-scan", n, cg::bench::bestOfMs(3, [&] { cg::bench::doNotOptimize(computeSize()); }));
+        cg::mif::setCandidatePruning(true);
+        const auto size = computeSize();
+        cg::bench::printRow(name + "/candidates", n, cg::bench::bestOfMs(3, [&] { cg::bench::doNotOptimize(computeSize()); }));
+        if (size != fullSize)
+        {
+            std::cout << name << ": size " << size << " differs from the full scan's " << fullSize << "\n";
+        }
+    }
+}
+
+int main()
+{
+    for (auto n : {20, 40, 60})
+    {
+        const cg::data_structures::DistinctIntervalModel model(cg::interval_model_utils::generateRandomIntervals(n, 4242 + n));
+        const cg::mif::IntervalCandidates candidates(model.allIntervals());
+        const auto M = 2 * n;
+
+        long nestedTotal = 0;
+        long crossingTotal = 0;
+        for (auto R = 0; R < M; ++R)
+        {
+            for (auto a = -1; a < R; ++a)
+            {
+                nestedTotal += static_cast<long>(candidates.nestedIn(a, R).size());
+            }
+            crossingTotal += static_cast<long>(candidates.crossing(R).size());
+        }
+        const auto nestedCells = static_cast<double>(M) * (M + 1) / 2;
+        std::cout << "n=" << n << " avg nestedIn=" << nestedTotal / nestedCells << " avg crossing=" << static_cast<double>(crossingTotal) / M << "\n";
+
+        compare("NickSimplerMif::computeMifSize", n, [&] { return cg::mif::NickSimplerMif::computeMifSize(model); });
+        compare("MifRscanN5Qspace::computeMifSize", n, [&] { return cg::mif::MifRscanN5Qspace::computeMifSize(model); });
+    }
+    return 0;
+}
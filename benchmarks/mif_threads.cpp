@@ -0,0 +1,64 @@
+#include "bench_utils.h"
+
+#include "data_structures/interval.h"
+#include "data_structures/distinct_interval_model.h"
+#include "mif/mif_rscan_n5_qspace.h"
+#include "mif/nick_simpler_mif.h"
+#include "utils/interval_model_utils.h"
+#include "utils/thread_pool.h"
+
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Times NickSimplerMif::computeMifSize and MifRscanN5Qspace::computeMifSize on random interval models for a range of
+// thread counts, up to the number of hardware threads. Every thread count must return the same size; the speed-up is
+// bounded by the cores available.
+int main()
+{
+    const auto hardwareThreads = cg::utils::ThreadPool::resolveThreadCount(0);
+    std::vector<int> threadCounts{1};
+    for (auto t = 2; t < hardwareThreads; t *= 2)
+    {
+        threadCounts.push_back(t);
+    }
+    if (hardwareThreads > 1)
+    {
+        threadCounts.push_back(hardwareThreads);
+    }
+
+    using Solver = int (*)(const cg::data_structures::DistinctIntervalModel &, int);
+    const std::vector<std::pair<std::string, Solver>> solvers{
+        {"NickSimplerMif", &cg::mif::NickSimplerMif::computeMifSize},
+        {"MifRscanN5Qspace", &cg::mif::MifRscanN5Qspace::computeMifSize}};
+
+    for (auto n : {20, 40, 60})
+    {
+        const cg::data_structures::DistinctIntervalModel model(cg::interval_model_utils::generateRandomIntervals(n, 4242 + n));
+        int expected = -1;
+        for (const auto &[name, solver] : solvers)
+        {
+            for (auto threadCount : threadCounts)
+            {
+                int size = 0;
+                const auto ms = cg::bench::bestOfMs(3, [&]
+                {
+                    size = solver(model, threadCount);
+                    cg::bench::doNotOptimize(size);
+                });
+                if (expected < 0)
+                {
+                    expected = size;
+                }
+                else if (size != expected)
+                {
+                    std::cerr << name << " size mismatch with " << threadCount << " threads: " << size << " != " << expected << "\n";
+                    return 1;
+                }
+                cg::bench::printRow(name + ", threads=" + std::to_string(threadCount), n, ms);
+            }
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,85 @@
+#include "bench_utils.h"
+
+#include "data_structures/interval.h"
+#include "data_structures/distinct_interval_model.h"
+#include "data_structures/shared_interval_model.h"
+#include "mis/distinct/naive.h"
+#include "mis/distinct/valiente.h"
+#include "mis/distinct/pure_output_sensitive.h"
+#include "mis/distinct/lazy_output_sensitive.h"
+#include "mis/shared/naive.h"
+#include "mis/shared/valiente.h"
+#include "mis/shared/pure_output_sensitive.h"
+#include "mis/shared/pruned_output_sensitive.h"
+#include "utils/counters.h"
+#include "utils/interval_model_utils.h"
+
+#include <limits>
+#include <string>
+#include <vector>
+
+// Compares each solver's computeMIS/tryComputeMIS, which records and rebuilds the independent set, against its
+// size-only entry point, which runs the same recurrence with all solution bookkeeping compiled out.
+namespace
+{
+    using cg::data_structures::Interval;
+    constexpr int Unbounded = std::numeric_limits<int>::max();
+    constexpr int Repetitions = 3;
+
+    template <typename FFull, typename FSize>
+    void compare(const std::string &name, long n, FFull &&full, FSize &&sizeOnly)
+    {
+        cg::bench::printRow(name + "/full", n, cg::bench::bestOfMs(Repetitions, [&] { cg::bench::doNotOptimize(full()); }));
+        cg::bench::printRow(name + "/size-only", n, cg::bench::bestOfMs(Repetitions, [&] { cg::bench::doNotOptimize(sizeOnly()); }));
+    }
+
+    void runDistinct(const std::string &name, const std::vector<Interval> &intervals, bool includeQuadratic)
+    {
+        using namespace cg::mis::distinct;
+        const cg::data_structures::DistinctIntervalModel model(intervals);
+        const long n = model.size;
+
+        if (includeQuadratic)
+        {
+            compare(name + " d::Naive", n, [&] { return Naive::computeMIS(model).size(); }, [&] { return Naive::computeMISSize(model); });
+            compare(name + " d::Valiente", n, [&] { return Valiente::computeMIS(model).size(); }, [&] { return Valiente::computeMISSize(model); });
+        }
+        cg::utils::Counters<PureOutputSensitive::Counts> pureCounts;
+        compare(name + " d::PureOS", n,
+                [&] { return PureOutputSensitive::tryComputeMIS(model, Unbounded, pureCounts)->size(); },
+                [&] { return *PureOutputSensitive::tryComputeMISSize(model, Unbounded, pureCounts); });
+        cg::utils::Counters<LazyOutputSensitive::Counts> lazyCounts;
+        compare(name + " d::LazyOS", n,
+                [&] { return LazyOutputSensitive::tryComputeMIS(model, Unbounded, lazyCounts)->size(); },
+                [&] { return *LazyOutputSensitive::tryComputeMISSize(model, Unbounded, lazyCounts); });
+    }
+
+    void runShared(const std::string &name, const std::vector<Interval> &intervals)
+    {
+        using namespace cg::mis::shared;
+        const cg::data_structures::SharedIntervalModel model(intervals);
+        const long n = model.size;
+
+        cg::utils::Counters<Naive::Counts> naiveCounts;
+        compare(name + " s::Naive", n, [&] { return Naive::computeMIS(model, naiveCounts).size(); }, [&] { return Naive::computeMISSize(model, naiveCounts); });
+        cg::utils::Counters<Valiente::Counts> valienteCounts;
+        compare(name + " s::Valiente", n, [&] { return Valiente::computeMIS(model, valienteCounts).size(); }, [&] { return Valiente::computeMISSize(model, valienteCounts); });
+        cg::utils::Counters<PureOutputSensitive::Counts> pureCounts;
+        compare(name + " s::PureOS", n,
+                [&] { return PureOutputSensitive::tryComputeMIS(model, Unbounded, pureCounts)->size(); },
+                [&] { return *PureOutputSensitive::tryComputeMISSize(model, Unbounded, pureCounts); });
+        cg::utils::Counters<PrunedOutputSensitive::Counts> prunedCounts;
+        compare(name + " s::PrunedOS", n,
+                [&] { return PrunedOutputSensitive::tryComputeMIS(model, Unbounded, prunedCounts)->size(); },
+                [&] { return *PrunedOutputSensitive::tryComputeMISSize(model, Unbounded, prunedCounts); });
+    }
+}
+
+int main()
+{
+    runDistinct("random", cg::interval_model_utils::generateRandomIntervals(2000, 42), true);
+    runDistinct("random", cg::interval_model_utils::generateRandomIntervals(20000, 42), false);
+    runDistinct("layered", cg::interval_model_utils::generateLayeredHardCaseNonPrime(1000), true);
+    runShared("random", cg::interval_model_utils::generateRandomIntervalsShared(2000, 4, 50, 42));
+    return 0;
+}
@@ -0,0 +1,60 @@
+#include "bench_utils.h"
+
+#include "data_structures/interval.h"
+#include "data_structures/distinct_interval_model.h"
+#include "mis/monotone_seq.h"
+#include "mis/segment_tree_monotone_seq.h"
+#include "mis/distinct/lazy_output_sensitive.h"
+#include "utils/counters.h"
+#include "utils/interval_model_utils.h"
+
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+// Compares the vector-backed MonotoneSeq against SegmentTreeMonotoneSeq, first on a stream of random raising updates
+// (each of which overwrites a long run, the case the vector walks linearly), then end to end inside LazyOutputSensitive.
+namespace
+{
+    constexpr int NumUpdates = 1000;
+
+    template <typename TMonotoneSeq>
+    long randomUpdates(int size)
+    {
+        TMonotoneSeq seq(size);
+        std::mt19937 rng(42);
+        std::uniform_int_distribution<int> index(0, size - 1);
+        long sum = 0;
+        for (auto op = 0; op < NumUpdates; ++op)
+        {
+            const auto idx = index(rng);
+            const auto range = seq.set(idx, seq.get(idx) + 1);
+            sum += range.changeEndExclusive - range.changeStartInclusive;
+        }
+        return sum + seq.get(0);
+    }
+
+    template <typename TMonotoneSeq>
+    int lazySize(const cg::data_structures::DistinctIntervalModel &model)
+    {
+        cg::utils::Counters<cg::mis::distinct::LazyOutputSensitive::Counts> counts;
+        return *cg::mis::distinct::LazyOutputSensitive::tryComputeMISSize<TMonotoneSeq>(model, std::numeric_limits<int>::max(), counts);
+    }
+}
+
+int main()
+{
+    for (auto size : {100000, 1000000, 10000000})
+    {
+        cg::bench::printRow("random-updates vector", size, cg::bench::bestOfMs(3, [&] { cg::bench::doNotOptimize(randomUpdates<cg::mis::MonotoneSeq>(size)); }));
+        cg::bench::printRow("random-updates segment-tree", size, cg::bench::bestOfMs(3, [&] { cg::bench::doNotOptimize(randomUpdates<cg::mis::SegmentTreeMonotoneSeq>(size)); }));
+    }
+    for (auto numLayers : {500, 1000, 2000})
+    {
+        const cg::data_structures::DistinctIntervalModel model(cg::interval_model_utils::generateLayeredHardCaseNonPrime(numLayers));
+        cg::bench::printRow("lazy layered vector", model.size, cg::bench::bestOfMs(3, [&] { cg::bench::doNotOptimize(lazySize<cg::mis::MonotoneSeq>(model)); }));
+        cg::bench::printRow("lazy layered segment-tree", model.size, cg::bench::bestOfMs(3, [&] { cg::bench::doNotOptimize(lazySize<cg::mis::SegmentTreeMonotoneSeq>(model)); }));
+    }
+    return 0;
+}
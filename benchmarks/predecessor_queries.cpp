@@ -0,0 +1,104 @@
+#include "bench_utils.h"
+
+#include "data_structures/interval.h"
+#include "data_structures/distinct_interval_model.h"
+#include "utils/interval_model_utils.h"
+
+#include <algorithm>
+#include <optional>
+#include <string>
+#include <vector>
+
+// Compares DistinctIntervalModel's precomputed predecessor arrays against the std::lower_bound search it replaced,
+// both for independent queries at every end-point and for walking the whole predecessor chain the way
+// LazyOutputSensitive::tryUpdate does.
+namespace
+{
+    using cg::data_structures::Interval;
+
+    class BinarySearchPredecessor
+    {
+        std::vector<Interval> _intervalsByIncreasingRightEndpoint;
+    public:
+        explicit BinarySearchPredecessor(const cg::data_structures::DistinctIntervalModel &model)
+        {
+            const auto decreasing = model.getAllIntervalsByDecreasingRightEndpoint();
+            _intervalsByIncreasingRightEndpoint.assign(decreasing.rbegin(), decreasing.rend());
+        }
+
+        [[nodiscard]] std::optional<Interval> tryGetRightEndpointPredecessorInterval(int rightEndpointUpperBoundExclusive) const
+        {
+            auto it = std::lower_bound(_intervalsByIncreasingRightEndpoint.begin(), _intervalsByIncreasingRightEndpoint.end(), rightEndpointUpperBoundExclusive,
+                                       [](const Interval &interval, int value) { return interval.Right < value; });
+            if (it == _intervalsByIncreasingRightEndpoint.begin())
+            {
+                return std::nullopt;
+            }
+            return *std::prev(it);
+        }
+    };
+
+    template <typename TModel>
+    long allQueries(const TModel &model, int end)
+    {
+        long sum = 0;
+        for (auto e = 0; e <= end; ++e)
+        {
+            const auto maybeInterval = model.tryGetRightEndpointPredecessorInterval(e);
+            if (maybeInterval)
+            {
+                sum += maybeInterval->Index;
+            }
+        }
+        return sum;
+    }
+
+    template <typename TModel>
+    long chainWalk(const TModel &model, int end)
+    {
+        long sum = 0;
+        auto maybeInterval = model.tryGetRightEndpointPredecessorInterval(end);
+        while (maybeInterval)
+        {
+            sum += maybeInterval->Index;
+            maybeInterval = model.tryGetRightEndpointPredecessorInterval(maybeInterval->Right);
+        }
+        return sum;
+    }
+
+    long rawChainWalk(const cg::data_structures::DistinctIntervalModel &model)
+    {
+        long sum = 0;
+        for (auto right = model.rightEndpointPredecessor(model.end); right != cg::data_structures::DistinctIntervalModel::NoEndpoint; right = model.rightEndpointPredecessor(right))
+        {
+            sum += model.intervalIndexAt(right);
+        }
+        return sum;
+    }
+
+    void run(const std::string &name, const std::vector<Interval> &intervals)
+    {
+        const cg::data_structures::DistinctIntervalModel model(intervals);
+        const BinarySearchPredecessor binarySearch(model);
+        constexpr int repetitions = 5;
+
+        cg::bench::printRow(name + " queries/binary-search", model.size, cg::bench::bestOfMs(repetitions, [&] { cg::bench::doNotOptimize(allQueries(binarySearch, model.end)); }));
+        cg::bench::printRow(name + " queries/rank-array", model.size, cg::bench::bestOfMs(repetitions, [&] { cg::bench::doNotOptimize(allQueries(model, model.end)); }));
+        cg::bench::printRow(name + " chain/binary-search", model.size, cg::bench::bestOfMs(repetitions, [&] { cg::bench::doNotOptimize(chainWalk(binarySearch, model.end)); }));
+        cg::bench::printRow(name + " chain/rank-array", model.size, cg::bench::bestOfMs(repetitions, [&] { cg::bench::doNotOptimize(chainWalk(model, model.end)); }));
+        cg::bench::printRow(name + " chain/rank-array-raw", model.size, cg::bench::bestOfMs(repetitions, [&] { cg::bench::doNotOptimize(rawChainWalk(model)); }));
+    }
+}
+
+int main()
+{
+    for (auto numLayers : {1000, 100000, 1000000})
+    {
+        run("layered-non-prime", cg::interval_model_utils::generateLayeredHardCaseNonPrime(numLayers));
+    }
+    for (auto numIntervals : {2000, 200000, 2000000})
+    {
+        run("random", cg::interval_model_utils::generateRandomIntervals(numIntervals, 42));
+    }
+    return 0;
+}
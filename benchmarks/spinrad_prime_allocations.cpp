@@ -0,0 +1,73 @@
+#include "bench_utils.h"
+
+#include "data_structures/csr_graph.h"
+#include "data_structures/interval.h"
+#include "data_structures/distinct_interval_model.h"
+#include "utils/interval_model_utils.h"
+#include "utils/spinrad_prime.h"
+
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <string>
+
+// Counts the heap allocations and bytes requested by one SpinradPrime::trySplit call (through a replaced global
+// operator new) and times it, on the circle graphs of the layered and the nested prime interval models.
+namespace
+{
+    std::size_t allocationCount = 0;
+    std::size_t allocatedBytes = 0;
+}
+
+void *operator new(std::size_t size)
+{
+    ++allocationCount;
+    allocatedBytes += size;
+    if (auto *p = std::malloc(size == 0 ? 1 : size))
+    {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void *p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void *p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+namespace
+{
+    void measure(const std::string &name, const cg::data_structures::CsrGraph &g)
+    {
+        cg::utils::SpinradPrime sp;
+        const auto countBefore = allocationCount;
+        const auto bytesBefore = allocatedBytes;
+        const auto split = sp.trySplit(g);
+        const auto count = allocationCount - countBefore;
+        const auto bytes = allocatedBytes - bytesBefore;
+        const auto ms = cg::bench::bestOfMs(3, [&] { cg::bench::doNotOptimize(sp.trySplit(g).has_value()); });
+        cg::bench::printRow(name + (split ? ", split" : ", prime"), g.numVertices(), ms);
+        std::cout << "  " << count << " allocations, " << bytes / 1024 << " KiB per call\n";
+    }
+}
+
+int main()
+{
+    for (auto layers : {25, 100})
+    {
+        const cg::data_structures::DistinctIntervalModel model(cg::interval_model_utils::generateLayeredHardCasePrime(layers));
+        measure("trySplit, layered prime", cg::data_structures::CsrGraph::fromIntervalModel(model));
+    }
+    for (auto n : {250, 1000})
+    {
+        const cg::data_structures::DistinctIntervalModel model(cg::interval_model_utils::generatePrimeNestedIntervals(n));
+        measure("trySplit, prime nested", cg::data_structures::CsrGraph::fromIntervalModel(model));
+    }
+    return 0;
+}
@@ -0,0 +1,66 @@
+#include "bench_utils.h"
+
+#include "data_structures/csr_graph.h"
+#include "data_structures/interval.h"
+#include "data_structures/distinct_interval_model.h"
+#include "utils/component_decomposition.h"
+#include "utils/interval_model_utils.h"
+#include "utils/split_decomposition.h"
+#include "utils/thread_pool.h"
+
+#include <algorithm>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// Times SplitDecomposition on the layered prime hard cases (a single prime node) and on the largest component of
+// random circle graphs, on one thread and on all hardware threads, and reports the shape of the tree.
+namespace
+{
+    void run(const std::string &name, const cg::data_structures::CsrGraph &graph, const std::vector<int> &threadCounts)
+    {
+        for (auto threadCount : threadCounts)
+        {
+            std::size_t numNodes = 0;
+            std::size_t largestPrime = 0;
+            const auto ms = cg::bench::bestOfMs(3, [&]
+            {
+                const auto tree = cg::utils::SplitDecomposition::decompose(graph, threadCount);
+                numNodes = tree.nodes().size();
+                largestPrime = 0;
+                for (const auto &node : tree.nodes())
+                {
+                    if (node.type == cg::utils::SplitNodeType::Prime)
+                    {
+                        largestPrime = std::max(largestPrime, node.vertices.size());
+                    }
+                }
+            });
+            cg::bench::printRow(name + ", threads=" + std::to_string(threadCount), graph.numVertices(), ms);
+            std::cout << "    " << numNodes << " nodes, largest prime node " << largestPrime << "\n";
+        }
+    }
+}
+
+int main()
+{
+    const auto hardwareThreads = cg::utils::ThreadPool::resolveThreadCount(0);
+    std::vector<int> threadCounts{1};
+    if (hardwareThreads > 1)
+    {
+        threadCounts.push_back(hardwareThreads);
+    }
+
+    for (auto layers : {25, 100, 250})
+    {
+        const cg::data_structures::DistinctIntervalModel model(cg::interval_model_utils::generateLayeredHardCasePrime(layers));
+        run("layered prime, layers=" + std::to_string(layers), cg::data_structures::CsrGraph::fromIntervalModel(model), threadCounts);
+    }
+    for (auto n : {200, 500, 1000})
+    {
+        const cg::data_structures::DistinctIntervalModel model(cg::interval_model_utils::generateRandomIntervals(n, 42 + n));
+        const auto largest = cg::components::decompose(model).front();
+        run("random circle graph, n=" + std::to_string(n), cg::data_structures::CsrGraph::fromIntervalModel(largest.model), threadCounts);
+    }
+    return 0;
+}
@@ -0,0 +1,70 @@
+#include "bench_utils.h"
+
+#include "data_structures/interval.h"
+#include "data_structures/distinct_interval_model.h"
+#include "mis/unit_monotone_seq.h"
+#include "mis/flat_unit_monotone_seq.h"
+#include "mis/distinct/implicit_output_sensitive.h"
+#include "mis/distinct/simple_implicit_output_sensitive.h"
+#include "utils/counters.h"
+#include "utils/interval_model_utils.h"
+
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+// Compares the std::map backed UnitMonotoneSeq against FlatUnitMonotoneSeq, first on a stream of random increments
+// with a get after each, then end to end inside the two implicit solvers.
+namespace
+{
+    template <typename TUnitMonotoneSeq>
+    long randomIncrements(int size)
+    {
+        TUnitMonotoneSeq seq(size);
+        std::mt19937 rng(42);
+        std::uniform_int_distribution<int> index(0, size - 1);
+        long sum = 0;
+        for (auto op = 0; op < size; ++op)
+        {
+            const auto range = seq.increment(index(rng));
+            sum += range.right - range.left + seq.get(range.changePoint);
+        }
+        return sum;
+    }
+
+    template <typename TSolver, typename TUnitMonotoneSeq>
+    long solve(const cg::data_structures::DistinctIntervalModel &model)
+    {
+        cg::utils::Counters<typename TSolver::Counts> counts;
+        return static_cast<long>(TSolver::template tryComputeMIS<TUnitMonotoneSeq>(model, std::numeric_limits<int>::max(), counts)->size());
+    }
+
+    template <typename TSolver>
+    void compareSolver(const std::string &name, const cg::data_structures::DistinctIntervalModel &model)
+    {
+        cg::bench::printRow(name + " map", model.size, cg::bench::bestOfMs(3, [&] { cg::bench::doNotOptimize(solve<TSolver, cg::mis::UnitMonotoneSeq>(model)); }));
+        cg::bench::printRow(name + " flat", model.size, cg::bench::bestOfMs(3, [&] { cg::bench::doNotOptimize(solve<TSolver, cg::mis::FlatUnitMonotoneSeq>(model)); }));
+    }
+}
+
+int main()
+{
+    for (auto size : {100000, 1000000, 10000000})
+    {
+        cg::bench::printRow("random-increments map", size, cg::bench::bestOfMs(3, [&] { cg::bench::doNotOptimize(randomIncrements<cg::mis::UnitMonotoneSeq>(size)); }));
+        cg::bench::printRow("random-increments flat", size, cg::bench::bestOfMs(3, [&] { cg::bench::doNotOptimize(randomIncrements<cg::mis::FlatUnitMonotoneSeq>(size)); }));
+    }
+    for (auto numIntervals : {20000, 200000})
+    {
+        const cg::data_structures::DistinctIntervalModel model(cg::interval_model_utils::generateRandomIntervals(numIntervals, 42));
+        compareSolver<cg::mis::distinct::SimpleImplicitOutputSensitive>("random simple-implicit", model);
+        compareSolver<cg::mis::distinct::ImplicitOutputSensitive>("random implicit", model);
+    }
+    {
+        const cg::data_structures::DistinctIntervalModel model(cg::interval_model_utils::generateLayeredHardCaseNonPrime(1000));
+        compareSolver<cg::mis::distinct::SimpleImplicitOutputSensitive>("layered simple-implicit", model);
+        compareSolver<cg::mis::distinct::ImplicitOutputSensitive>("layered implicit", model);
+    }
+    return 0;
+}
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "data_structures/graph.h"
+
+namespace cg::data_structures
+{
+    class DistinctIntervalModel;
+    class ChordModel;
+
+    // An immutable undirected graph in compressed sparse row form: the neighbours of v are the sorted, duplicate-free
+    // run _adjacency[_offsets[v], _offsets[v + 1]). One int per edge end and one offset per vertex, against a hash
+    // node per edge end plus buckets for Graph, and neighbour scans are sequential reads. hasEdge is a binary search
+    // in the shorter of the two runs, or a single bit read when the graph is dense enough that an n x n adjacency
+    // bit matrix is no larger than the adjacency array itself. Build it with a Builder, from an existing Graph, or
+    // straight from an interval or chord model.
+    class CsrGraph
+    {
+    public:
+        using Vertex = int;
+        using Neighbours = std::span<const Vertex>;
+
+        // Collects an edge list (in any order, duplicates and both orientations allowed) and sorts it into a CsrGraph.
+        class Builder
+        {
+            int _numVertices;
+            std::vector<std::pair<Vertex, Vertex>> _edges;
+        public:
+            explicit Builder(int numVertices);
+
+            void reserve(std::size_t numEdges);
+
+            void addEdge(Vertex u, Vertex v);
+
+            [[nodiscard]] CsrGraph build() const;
+        };
+
+    private:
+        std::vector<std::size_t> _offsets;
+        std::vector<Vertex> _adjacency;
+        std::size_t _matrixWordsPerRow = 0;
+        std::vector<std::uint64_t> _matrix; // Empty unless the graph is dense, see buildMatrixIfDense.
+
+        CsrGraph(std::vector<std::size_t> offsets, std::vector<Vertex> adjacency);
+
+        // Symmetrises, sorts and deduplicates the edges of all chunks in O(n + m).
+        [[nodiscard]] static CsrGraph fromEdgeChunks(int numVertices, std::span<const std::vector<std::pair<Vertex, Vertex>>> edgeChunks);
+
+        void buildMatrixIfDense();
+
+    public:
+        explicit CsrGraph(const Graph &graph);
+
+        // The circle graph of a model: one vertex per Interval::Index and an edge between every two crossing
+        // intervals (Interval::overlaps). A sweep over the end-points keeps the open intervals in a list ordered by
+        // left end-point. At the right end-point of i, every interval after i in that list crosses i, so the crossing
+        // pairs are enumerated in O(n + m) rather than by O(n^2) pairwise tests. With threadCount != 1 the end-points
+        // are cut into ranges that are swept in parallel (values below 1 mean all hardware threads).
+        [[nodiscard]] static CsrGraph fromIntervalModel(const DistinctIntervalModel &intervalModel, int threadCount = 1);
+
+        // The circle graph of chordModel.toDistinctIntervalModel(), with one vertex per Chord::index.
+        [[nodiscard]] static CsrGraph fromChordModel(const ChordModel &chordModel, int threadCount = 1);
+
+        [[nodiscard]] int numVertices() const;
+
+        // Length of the adjacency array: two entries per edge, one per self-loop.
+        [[nodiscard]] std::size_t numEdgeEnds() const;
+
+        [[nodiscard]] Neighbours neighbours(Vertex v) const;
+
+        [[nodiscard]] int degree(Vertex v) const;
+
+        [[nodiscard]] bool hasEdge(Vertex u, Vertex v) const;
+
+        // Bytes held by the offset and adjacency arrays and the adjacency bit matrix.
+        [[nodiscard]] std::size_t memoryBytes() const;
+    };
+}
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <optional>
 #include <span>
 #include <vector>
@@ -11,13 +12,25 @@ namespace cg::data_structures
     class Interval;
     class DistinctIntervalModel
     {
-        std::vector<std::optional<Interval>> _leftEndpointToInterval; 
-        std::vector<std::optional<Interval>> _rightEndpointToInterval; 
-        std::vector<Interval> _indexToInterval;
-        std::vector<Interval> _intervalsByIncreasingRightEndpoint;
+        // End-points are dense in [0, end), so each end-point is described by two flat int32 columns rather than a
+        // std::optional<Interval> per end-point: the other end-point of the interval it belongs to, and that interval's index.
+        // An end-point e is a left end-point exactly when _endpointToPartner[e] > e.
+        std::vector<std::int32_t> _endpointToPartner;
+        std::vector<std::int32_t> _endpointToIndex;
+        std::vector<std::int32_t> _indexToLeft;
+        std::vector<std::int32_t> _indexToWeight;
+        // _rightEndpointPredecessor[e] is the largest right end-point strictly below e (or NoEndpoint), for e in [0, end].
+        // Because end-points are dense this turns a predecessor query into one load, and following the array from a right
+        // end-point walks the right end-points in decreasing order like a linked list. Likewise for left end-points.
+        std::vector<std::int32_t> _rightEndpointPredecessor;
+        std::vector<std::int32_t> _leftEndpointPredecessor;
         std::vector<Interval> _intervalsByIncreasingLeftEndpoint;
         std::vector<Interval> _intervalsByDecreasingRightEndpoint;
+
+        [[nodiscard]] Interval makeInterval(int left, int right, int intervalIndex) const;
     public:
+        static constexpr std::int32_t NoEndpoint = -1;
+
         const int end; 
         const int size;
 
@@ -38,6 +51,19 @@ namespace cg::data_structures
         [[nodiscard]] std::vector<Interval> getAllIntervals() const;
         [[nodiscard]] std::vector<Interval> getAllIntervalsByDecreasingRightEndpoint() const;
 
+        // Non-owning views of the same sequences as getAllIntervals() and getAllIntervalsByDecreasingRightEndpoint(),
+        // valid for the lifetime of the model. Prefer these on hot paths, they never allocate.
+        [[nodiscard]] std::span<const Interval> allIntervals() const { return _intervalsByIncreasingLeftEndpoint; }
+        [[nodiscard]] std::span<const Interval> allIntervalsByDecreasingRightEndpoint() const { return _intervalsByDecreasingRightEndpoint; }
+
+        [[nodiscard]] bool isLeftEndpoint(int endpoint) const { return _endpointToPartner[endpoint] > endpoint; }
+        [[nodiscard]] bool isRightEndpoint(int endpoint) const { return _endpointToPartner[endpoint] < endpoint; }
+        [[nodiscard]] int partnerEndpoint(int endpoint) const { return _endpointToPartner[endpoint]; }
+        [[nodiscard]] int intervalIndexAt(int endpoint) const { return _endpointToIndex[endpoint]; }
+        [[nodiscard]] int weightOf(int intervalIndex) const { return _indexToWeight[intervalIndex]; }
+        [[nodiscard]] int rightEndpointPredecessor(int rightEndpointUpperBoundExclusive) const { return _rightEndpointPredecessor[rightEndpointUpperBoundExclusive]; }
+        [[nodiscard]] int leftEndpointPredecessor(int leftEndpointUpperBoundExclusive) const { return _leftEndpointPredecessor[leftEndpointUpperBoundExclusive]; }
+
         [[nodiscard]] auto rightEndpoints() const;
         [[nodiscard]] auto rightEndpointsDescending() const;
         [[nodiscard]] auto leftEndpoints() const;
@@ -47,14 +73,14 @@ namespace cg::data_structures
 
     [[nodiscard]] inline auto DistinctIntervalModel::rightEndpoints() const
     {
-        return _intervalsByIncreasingRightEndpoint
+        return _intervalsByDecreasingRightEndpoint
+               | std::views::reverse
                | std::views::transform([](const Interval &i) { return i.Right; });
     }
 
     [[nodiscard]] inline auto DistinctIntervalModel::rightEndpointsDescending() const
     {
-        return _intervalsByIncreasingRightEndpoint
-               | std::views::reverse
+        return _intervalsByDecreasingRightEndpoint
                | std::views::transform([](const Interval &i) { return i.Right; });
     }
 
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <concepts>
+#include <cstddef>
 #include <vector>
 #include <unordered_set>
 
@@ -22,5 +24,18 @@ namespace cg::data_structures
         int numVertices() const;
 
         const Neighbours &neighbours(Vertex v) const;
+
+        bool hasEdge(Vertex u, Vertex v) const;
+    };
+
+    // What the graph algorithms (e.g. SpinradPrime) read from a graph: the vertex count, an iterable neighbourhood per
+    // vertex and an adjacency test. Satisfied by the mutable Graph and by the immutable CsrGraph.
+    template <class TGraph>
+    concept AdjacencyGraph = requires(const TGraph &g, typename TGraph::Vertex v)
+    {
+        { g.numVertices() } -> std::convertible_to<int>;
+        { g.neighbours(v).size() } -> std::convertible_to<std::size_t>;
+        { *g.neighbours(v).begin() } -> std::convertible_to<typename TGraph::Vertex>;
+        { g.hasEdge(v, v) } -> std::same_as<bool>;
     };
 }
@@ -8,8 +8,12 @@ namespace cg::data_structures
     class Interval;
     class SharedIntervalModel
     {
-        std::vector<std::vector<Interval>> _leftEndpointToIntervals;
-        std::vector<std::vector<Interval>> _rightEndpointToIntervals;
+        // Compressed-sparse-row buckets: the intervals with left end-point e are
+        // _leftIntervals[_leftOffsets[e] .. _leftOffsets[e + 1]), longest first, and likewise for right end-points.
+        std::vector<int> _leftOffsets;
+        std::vector<Interval> _leftIntervals;
+        std::vector<int> _rightOffsets;
+        std::vector<Interval> _rightIntervals;
     public:
         const int end;
         const int size;
@@ -18,5 +22,15 @@ namespace cg::data_structures
         [[nodiscard]] std::vector<Interval> getAllIntervalsWithLeftEndpoint(int leftEndpoint) const;
         [[nodiscard]] std::vector<Interval> getAllIntervalsWithRightEndpoint(int rightEndpoint) const;
         [[nodiscard]] Interval getIntervalByIndex(int intervalIndex) const;
+
+        // Non-owning views of the same buckets (longest interval first), valid for the lifetime of the model.
+        [[nodiscard]] std::span<const Interval> intervalsWithLeftEndpoint(int leftEndpoint) const
+        {
+            return std::span<const Interval>(_leftIntervals).subspan(_leftOffsets[leftEndpoint], _leftOffsets[leftEndpoint + 1] - _leftOffsets[leftEndpoint]);
+        }
+        [[nodiscard]] std::span<const Interval> intervalsWithRightEndpoint(int rightEndpoint) const
+        {
+            return std::span<const Interval>(_rightIntervals).subspan(_rightOffsets[rightEndpoint], _rightOffsets[rightEndpoint + 1] - _rightOffsets[rightEndpoint]);
+        }
     };
-}
\ No newline at end of file
+}
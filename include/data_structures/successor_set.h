@@ -0,0 +1,98 @@
+#pragma once
+
+#include <bit>
+#include <cstdint>
+#include <vector>
+
+namespace cg::data_structures
+{
+    // An ordered set of positions in [0, numPositions) stored as a 64-ary tree of bitsets: level 0 has one bit per
+    // position and every level above has one bit per non-empty word below. Predecessor and successor queries touch
+    // one word per level (at most four levels up to 2^24 positions) and all storage is allocated in the constructor.
+    class SuccessorSet
+    {
+        static constexpr int WordShift = 6;
+        static constexpr int BitMask = (1 << WordShift) - 1;
+        std::vector<std::vector<uint64_t>> _levels;
+    public:
+        static constexpr int NoPosition = -1;
+
+        explicit SuccessorSet(int numPositions)
+        {
+            do
+            {
+                numPositions = (numPositions + BitMask) >> WordShift;
+                _levels.emplace_back(numPositions, 0);
+            } while (numPositions > 1);
+        }
+
+        [[nodiscard]] bool contains(int position) const
+        {
+            return (_levels[0][position >> WordShift] >> (position & BitMask)) & 1;
+        }
+
+        void insert(int position)
+        {
+            for (auto &level : _levels)
+            {
+                level[position >> WordShift] |= uint64_t{1} << (position & BitMask);
+                position >>= WordShift;
+            }
+        }
+
+        void erase(int position)
+        {
+            for (auto &level : _levels)
+            {
+                auto &word = level[position >> WordShift];
+                word &= ~(uint64_t{1} << (position & BitMask));
+                if (word != 0)
+                {
+                    return;
+                }
+                position >>= WordShift;
+            }
+        }
+
+        // Largest position in the set that is <= position, or NoPosition.
+        [[nodiscard]] int predecessor(int position) const
+        {
+            // Climb until some word holds a set bit at or below the current position, then descend along the highest bits.
+            for (size_t level = 0; level < _levels.size() && position >= 0; ++level)
+            {
+                const auto word = _levels[level][position >> WordShift] & (~uint64_t{0} >> (BitMask - (position & BitMask)));
+                if (word != 0)
+                {
+                    position = ((position >> WordShift) << WordShift) + BitMask - std::countl_zero(word);
+                    for (auto below = level; below > 0; --below)
+                    {
+                        position = (position << WordShift) + BitMask - std::countl_zero(_levels[below - 1][position]);
+                    }
+                    return position;
+                }
+                position = (position >> WordShift) - 1;
+            }
+            return NoPosition;
+        }
+
+        // Smallest position in the set that is >= position, or NoPosition.
+        [[nodiscard]] int successor(int position) const
+        {
+            for (size_t level = 0; level < _levels.size() && (position >> WordShift) < static_cast<int>(_levels[level].size()); ++level)
+            {
+                const auto word = _levels[level][position >> WordShift] & (~uint64_t{0} << (position & BitMask));
+                if (word != 0)
+                {
+                    position = ((position >> WordShift) << WordShift) + std::countr_zero(word);
+                    for (auto below = level; below > 0; --below)
+                    {
+                        position = (position << WordShift) + std::countr_zero(_levels[below - 1][position]);
+                    }
+                    return position;
+                }
+                position = (position >> WordShift) + 1;
+            }
+            return NoPosition;
+        }
+    };
+}
@@ -0,0 +1,10 @@
+#pragma once
+
+#include "utils/array_utils.h"
+
+namespace cg::mif
+{
+    // The rightForest(v, j, R) table of the interval DP kernels, stored so that j is contiguous for fixed v and R.
+    template <typename TScore>
+    using RightForestTable = cg::utils::tiled_array3<TScore, cg::utils::DimOrder::IKJ, 0>;
+}
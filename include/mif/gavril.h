@@ -4,7 +4,7 @@
 
 #include "data_structures/interval.h"
 #include "data_structures/distinct_interval_model.h"
-#include "utils/array_utils.h"
+#include "utils/sparse_array.h"
 
 namespace cg::data_structures
 {
@@ -15,8 +15,8 @@ namespace cg::data_structures
 
 namespace cg::mif
 {
-    using cg::utils::array3;
-    using cg::utils::array4;
+    using cg::utils::sparse_array3;
+    using cg::utils::sparse_array4;
 
         enum ChildType
         {
@@ -65,29 +65,48 @@ inline std::string_view to_string(ChildType t) {
         };
         struct Forests
         {
-            array4<ForestScore> leftForestScores;
-            array3<DummyForestScore> dummyLeftForestScores;
-            array4<ForestScore> rightForestScores;
-            array3<DummyForestScore> dummyRightForestScores;
+            sparse_array4<ForestScore> leftForestScores;
+            sparse_array3<DummyForestScore> dummyLeftForestScores;
+            sparse_array4<ForestScore> rightForestScores;
+            sparse_array3<DummyForestScore> dummyRightForestScores;
         };
         struct ChildChoices
         {
-            array4<ChildChoice> leftChildChoices;
-            array4<ChildChoice> rightChildChoices;
+            sparse_array4<ChildChoice> leftChildChoices;
+            sparse_array4<ChildChoice> rightChildChoices;
+        };
+        // Which layers of the forest score tables stay resident during the layer sweep. The recurrences for layer i
+        // only read layers i, i - 1 and i - 2, and constructMif only reads the top layer, so RollingLayers drops
+        // every older layer as the sweep advances. Child choices are needed at every layer for reconstruction; once a
+        // layer falls out of that window it is frozen into a compact sorted log instead.
+        enum class LayerRetention
+        {
+            AllLayers,
+            RollingLayers
+        };
+        // Peak size of the DP tables over the layer sweep.
+        struct TableStats
+        {
+            std::size_t storedEntries = 0;
+            std::size_t memoryBytes = 0;
+            std::size_t denseBytes = 0; // What the same tables would take as dense array3/array4s.
         };
 
-        static void computeRightForestBaseCase(const std::vector<cg::data_structures::Interval> &allIntervals, const std::vector<cg::data_structures::Interval>& firstLayerIntervals, array4<ForestScore>& rightForestScores, array3<DummyForestScore>& dummyRightForestScores, array4<ChildChoice>& rightChildChoices);
-        static void computeRightForests(int layerIdx, const std::vector<cg::data_structures::Interval>& cumulativeIntervals, Forests& forests, array4<ChildChoice>& rightChildChoices);
-        static void computeNewIntervalRightForests(int layerIdx, const std::vector<cg::data_structures::Interval>& newIntervalsAtThisLayer, const std::vector<cg::data_structures::Interval>& allIntervalsBeforeThisLayer, Forests& forests, array4<ChildChoice>& rightChildChoices);
-        static void computeRightChildChoices(const Forests &forests, const std::vector<cg::data_structures::Interval> allIntervals, const std::vector<cg::data_structures::Interval> &cumulativeIntervals, const std::vector<cg::data_structures::Interval> &cumulativeIntervalsOneBehind, array4<ChildChoice> &rightChildChoices, int layerIdx);
+        static void computeRightForestBaseCase(const std::vector<cg::data_structures::Interval>& firstLayerIntervals, sparse_array4<ForestScore>& rightForestScores, sparse_array3<DummyForestScore>& dummyRightForestScores, sparse_array4<ChildChoice>& rightChildChoices);
+        static void computeRightForests(int layerIdx, const std::vector<cg::data_structures::Interval>& cumulativeIntervals, Forests& forests, sparse_array4<ChildChoice>& rightChildChoices);
+        static void computeNewIntervalRightForests(int layerIdx, const std::vector<cg::data_structures::Interval>& newIntervalsAtThisLayer, const std::vector<cg::data_structures::Interval>& allIntervalsBeforeThisLayer, Forests& forests, sparse_array4<ChildChoice>& rightChildChoices);
+        static void computeRightChildChoices(const Forests &forests, std::span<const cg::data_structures::Interval> allIntervals, const std::vector<cg::data_structures::Interval> &cumulativeIntervals, const std::vector<cg::data_structures::Interval> &cumulativeIntervalsOneBehind, sparse_array4<ChildChoice> &rightChildChoices, int layerIdx);
 
-        static void computeLeftForestBaseCase(const std::vector<cg::data_structures::Interval> &allIntervals, const std::vector<cg::data_structures::Interval>& firstLayerIntervals, array4<ForestScore>& leftForestScores, array4<ChildChoice>& leftChildChoices);
-        static void computeLeftForests(int layerIdx, const std::vector<cg::data_structures::Interval>& cumulativeIntervals, Forests& forests, array4<ChildChoice>& leftChildChoices);
-        static void computeNewIntervalLeftForests(int layerIdx, const std::vector<cg::data_structures::Interval>& newIntervalsAtThisLayer, const std::vector<cg::data_structures::Interval>& allIntervalsBeforeThisLayer, Forests& forests, array4<ChildChoice>& leftChildChoices);
-        static void computeLeftChildChoices(const Forests &forests, const std::vector<cg::data_structures::Interval> allIntervals, const std::vector<cg::data_structures::Interval> &cumulativeIntervals, const std::vector<cg::data_structures::Interval> &cumulativeIntervalsOneBehind, array4<ChildChoice> &leftChildChoices, int layerIdx);
+        static void computeLeftForestBaseCase(const std::vector<cg::data_structures::Interval>& firstLayerIntervals, sparse_array4<ForestScore>& leftForestScores, sparse_array4<ChildChoice>& leftChildChoices);
+        static void computeLeftForests(int layerIdx, const std::vector<cg::data_structures::Interval>& cumulativeIntervals, Forests& forests, sparse_array4<ChildChoice>& leftChildChoices);
+        static void computeNewIntervalLeftForests(int layerIdx, const std::vector<cg::data_structures::Interval>& newIntervalsAtThisLayer, const std::vector<cg::data_structures::Interval>& allIntervalsBeforeThisLayer, Forests& forests, sparse_array4<ChildChoice>& leftChildChoices);
+        static void computeLeftChildChoices(const Forests &forests, std::span<const cg::data_structures::Interval> allIntervals, const std::vector<cg::data_structures::Interval> &cumulativeIntervals, const std::vector<cg::data_structures::Interval> &cumulativeIntervalsOneBehind, sparse_array4<ChildChoice> &leftChildChoices, int layerIdx);
       
         static std::vector<int> constructMif(const cg::data_structures::DistinctIntervalModel& intervalModel, int numLayers, const Forests& forests, const ChildChoices& innerChoices);
+        static TableStats tableStats(const Forests& forests, const ChildChoices& childChoices);
+        static void retireLayer(Forests& forests, ChildChoices& childChoices, int layerIdx);
         static std::vector<cg::data_structures::Interval> computeMif(std::span<const cg::data_structures::Interval> intervals, bool enableLogging = false);
+        static std::vector<cg::data_structures::Interval> computeMif(std::span<const cg::data_structures::Interval> intervals, TableStats& tableStats, LayerRetention retention = LayerRetention::AllLayers, bool enableLogging = false);
     };
 }
 
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <span>
+#include <vector>
+
+#include "data_structures/interval.h"
+
+namespace cg::mif
+{
+    // Precomputed candidate lists for the MIF DPs, which otherwise scan all n intervals per cell and skip those that
+    // are not nested in the cell or do not cross the root's endpoint. Intervals are identified by their position in
+    // the left-endpoint-sorted order the DPs iterate in (DistinctIntervalModel::allIntervals()), and every list is in
+    // increasing position, so enumerating a list visits the same intervals in the same order as the filtered scan.
+    // With pruning off every list holds all positions, which restores the full scan; the DPs keep their filters, so
+    // their results are the same either way.
+    class IntervalCandidates
+    {
+    public:
+        // intervalsByLeft must be sorted by increasing left endpoint, with endpoints 0 .. 2 * size - 1. Pruning is
+        // the candidatePruning() setting at construction.
+        explicit IntervalCandidates(std::span<const cg::data_structures::Interval> intervalsByLeft);
+
+        // Positions v with a < Left(v) and Right(v) <= R, for -1 <= a and R < 2 * size.
+        [[nodiscard]] std::span<const int> nestedIn(int a, int R) const;
+
+        // Positions v with Left(v) < e < Right(v) and minLeft <= Left(v).
+        [[nodiscard]] std::span<const int> crossing(int e, int minLeft = 0) const;
+
+        // Position of the interval with left (right) endpoint e, or -1 if e is the other kind of endpoint.
+        [[nodiscard]] int byLeft(int e) const { return _byLeft[e]; }
+        [[nodiscard]] int byRight(int e) const { return _byRight[e]; }
+
+    private:
+        [[nodiscard]] static std::span<const int> suffixFrom(std::span<const int> positions, int firstPosition);
+
+        // _firstWithLeftAtLeast[x] is the first position whose left endpoint is >= x, for 0 <= x <= 2 * size.
+        std::vector<int> _firstWithLeftAtLeast;
+        std::vector<int> _byLeft;
+        std::vector<int> _byRight;
+        // CSR lists indexed by endpoint: the positions ending at or before R, and the positions crossing e.
+        std::vector<int> _endingByOffsets;
+        std::vector<int> _endingBy;
+        std::vector<int> _crossingOffsets;
+        std::vector<int> _crossing;
+        // Every position, returned by all queries when pruning is off.
+        std::vector<int> _allPositions;
+        bool _pruned;
+    };
+
+    // Whether new IntervalCandidates prune their lists; it starts on.
+    [[nodiscard]] bool candidatePruning();
+
+    // Turns the pruning off or back on, for benchmarks and tests that time or check the DPs against the full scan.
+    void setCandidatePruning(bool enabled);
+}
@@ -11,9 +11,11 @@ namespace cg::mif
     class NickSimplerMif
     {
     public:
-        [[nodiscard]] static int computeMifSize(const cg::data_structures::DistinctIntervalModel &intervalModel);
+        // threadCount is the number of threads the DP sweep runs on (values below 1 mean all hardware threads); the
+        // result is the same for every thread count.
+        [[nodiscard]] static int computeMifSize(const cg::data_structures::DistinctIntervalModel &intervalModel, int threadCount = 1);
         [[nodiscard]] static std::pair<int, std::vector<cg::data_structures::Interval>>
-        computeMif(const cg::data_structures::DistinctIntervalModel &intervalModel);
+        computeMif(const cg::data_structures::DistinctIntervalModel &intervalModel, int threadCount = 1);
     };
 }
 
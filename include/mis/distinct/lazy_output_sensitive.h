@@ -25,6 +25,7 @@ namespace cg::mis
     class IndependentSet;
     class ImplicitIndependentSet;
     class MonotoneSeq;
+    class SegmentTreeMonotoneSeq;
 }
 
 
@@ -46,8 +47,17 @@ namespace cg::mis::distinct
             cg::data_structures::Interval interval;
             int candidate;
         };
-        static bool tryUpdate(const cg::data_structures::DistinctIntervalModel &intervals, int leftLimit, std::map<int, PendingUpdate> &pendingUpdates,  cg::mis::ImplicitIndependentSet& independentSet, cg::mis::MonotoneSeq &MIS, std::vector<int> &CMIS, int maxAllowedMIS, cg::utils::Counters<Counts>& counts);
+        template <typename TIndependentSet, typename TMonotoneSeq>
+        static bool tryUpdate(const cg::data_structures::DistinctIntervalModel &intervals, int leftLimit, std::map<int, PendingUpdate> &pendingUpdates,  TIndependentSet& independentSet, TMonotoneSeq &MIS, std::vector<int> &CMIS, int maxAllowedMIS, cg::utils::Counters<Counts>& counts);
+        template <typename TMonotoneSeq, typename TIndependentSet>
+        static std::optional<int> tryComputeMISInternal(const cg::data_structures::DistinctIntervalModel &intervals, TIndependentSet& independentSet, int maxAllowedMIS, cg::utils::Counters<Counts>& counts);
     public:
+        // TMonotoneSeq holds the MIS values by left end-point: MonotoneSeq (linear set) or SegmentTreeMonotoneSeq (logarithmic set).
+        // Both are instantiated in lazy_output_sensitive.cpp.
+        template <typename TMonotoneSeq = cg::mis::MonotoneSeq>
         static std::optional<std::vector<cg::data_structures::Interval>> tryComputeMIS(const cg::data_structures::DistinctIntervalModel &intervals, int maxAllowedMIS, cg::utils::Counters<Counts>& counts);
+        // std::nullopt if the MIS weight exceeds maxAllowedMIS, as for tryComputeMIS.
+        template <typename TMonotoneSeq = cg::mis::MonotoneSeq>
+        static std::optional<int> tryComputeMISSize(const cg::data_structures::DistinctIntervalModel &intervals, int maxAllowedMIS, cg::utils::Counters<Counts>& counts);
     };
 }
@@ -11,8 +11,12 @@ namespace cg::mis::distinct
 {
     class Naive
     {
-        static void update(int endIndex, cg::mis::IndependentSet &independentSet, const cg::data_structures::DistinctIntervalModel &intervals, std::vector<int> &MIS, std::vector<int> &CMIS);
+        template <typename TIndependentSet>
+        static void update(int endIndex, TIndependentSet &independentSet, const cg::data_structures::DistinctIntervalModel &intervals, std::vector<int> &MIS, std::vector<int> &CMIS);
+        template <typename TIndependentSet>
+        static int computeMISInternal(const cg::data_structures::DistinctIntervalModel &intervals, TIndependentSet &independentSet);
     public:
         static std::vector<cg::data_structures::Interval> computeMIS(const cg::data_structures::DistinctIntervalModel &intervals);
+        static int computeMISSize(const cg::data_structures::DistinctIntervalModel &intervals);
     };
 }
\ No newline at end of file
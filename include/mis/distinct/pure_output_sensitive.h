@@ -29,8 +29,13 @@ namespace cg::mis::distinct
         };
     private:
         static void updateAt(std::stack<int> &pendingUpdates, std::vector<int> &MIS, int indexToUpdate, int newMisValue);
-        static bool tryUpdate(const cg::data_structures::DistinctIntervalModel &intervals, std::stack<int> &pendingUpdates, cg::mis::IndependentSet& independentSet, const cg::data_structures::Interval &interval, std::vector<int> &MIS, std::vector<int> &CMIS, int maxAllowedMIS, cg::utils::Counters<Counts>& counts);
+        template <typename TIndependentSet>
+        static bool tryUpdate(const cg::data_structures::DistinctIntervalModel &intervals, std::stack<int> &pendingUpdates, TIndependentSet& independentSet, const cg::data_structures::Interval &interval, std::vector<int> &MIS, std::vector<int> &CMIS, int maxAllowedMIS, cg::utils::Counters<Counts>& counts);
+        template <typename TIndependentSet>
+        static std::optional<int> tryComputeMISInternal(const cg::data_structures::DistinctIntervalModel &intervals, TIndependentSet& independentSet, int maxAllowedMIS, cg::utils::Counters<Counts>& counts);
     public:
         static std::optional<std::vector<cg::data_structures::Interval>> tryComputeMIS(const cg::data_structures::DistinctIntervalModel &intervals, int maxAllowedMIS, cg::utils::Counters<Counts>& counts);
+        // std::nullopt if the MIS weight exceeds maxAllowedMIS, as for tryComputeMIS.
+        static std::optional<int> tryComputeMISSize(const cg::data_structures::DistinctIntervalModel &intervals, int maxAllowedMIS, cg::utils::Counters<Counts>& counts);
     };
 }
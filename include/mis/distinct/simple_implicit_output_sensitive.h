@@ -25,6 +25,7 @@ namespace cg::mis
     class IndependentSet;
     class ImplicitIndependentSet;
     class UnitMonotoneSeq;
+    class FlatUnitMonotoneSeq;
 }
 
 
@@ -41,8 +42,12 @@ namespace cg::mis::distinct
             NumMembers
         };
     private:
-        static bool tryUpdate(const cg::data_structures::DistinctIntervalModel &intervals, std::stack<cg::data_structures::Interval> &pendingUpdates,  cg::mis::ImplicitIndependentSet& independentSet, const cg::data_structures::Interval &interval, cg::mis::UnitMonotoneSeq &MIS, std::vector<int> &CMIS, int maxAllowedMIS, cg::utils::Counters<Counts>& counts);
+        template <typename TUnitMonotoneSeq>
+        static bool tryUpdate(const cg::data_structures::DistinctIntervalModel &intervals, std::stack<cg::data_structures::Interval> &pendingUpdates,  cg::mis::ImplicitIndependentSet& independentSet, const cg::data_structures::Interval &interval, TUnitMonotoneSeq &MIS, std::vector<int> &CMIS, int maxAllowedMIS, cg::utils::Counters<Counts>& counts);
     public:
+        // TUnitMonotoneSeq holds the MIS values by left end-point: UnitMonotoneSeq (std::map of runs) or FlatUnitMonotoneSeq
+        // (bitset tree of runs). Both are instantiated in simple_implicit_output_sensitive.cpp.
+        template <typename TUnitMonotoneSeq = cg::mis::UnitMonotoneSeq>
         static std::optional<std::vector<cg::data_structures::Interval>> tryComputeMIS(const cg::data_structures::DistinctIntervalModel &intervals, int maxAllowedMIS, cg::utils::Counters<Counts>& counts);
     };
 }
@@ -6,7 +6,10 @@ namespace cg::mis::distinct
 {
     class Valiente
     {
+        template <typename TIndependentSet>
+        static int computeMISInternal(const cg::data_structures::DistinctIntervalModel& intervals, TIndependentSet &result);
     public:
         static std::vector<cg::data_structures::Interval> computeMIS(const cg::data_structures::DistinctIntervalModel& intervals);
+        static int computeMISSize(const cg::data_structures::DistinctIntervalModel& intervals);
     };
 }
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <vector>
+
+#include "data_structures/successor_set.h"
+#include "mis/unit_monotone_seq.h"
+
+namespace cg::mis
+{
+    // A drop-in replacement for UnitMonotoneSeq without per-run nodes. Run starts are kept in a SuccessorSet and each
+    // run's value lives in a flat array indexed by its start. All storage is allocated once, in the constructor.
+    class FlatUnitMonotoneSeq
+    {
+    private:
+        cg::data_structures::SuccessorSet _runStarts;
+        std::vector<int> _runStartToValue;          // Only meaningful at positions whose bit is set.
+        int _size;
+        // Positions are shifted by one so the sentinel run starting at -1 sits at position 0.
+        static int toPosition(int idx) { return idx + 1; }
+        static int toIndex(int position) { return position - 1; }
+        void validateIndex(int idx);
+    public:
+        using Range = UnitMonotoneSeq::Range;
+        FlatUnitMonotoneSeq(int size);
+        [[nodiscard]] int get(int idx);
+        Range increment(int idx);
+        void copyTo(std::vector<int>& target);
+    };
+}
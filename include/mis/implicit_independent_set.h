@@ -1,9 +1,8 @@
 #pragma once
 
 #include <vector>
-#include <map>
-#include <optional>
-#include <list>
+
+#include "data_structures/successor_set.h"
 
 namespace cg::data_structures
 {
@@ -14,18 +13,30 @@ namespace cg::mis
 {
     class ImplicitIndependentSet
     {
-        struct Range
+        static constexpr int NoInterval = -1;
+        struct ContainedNode
         {
-            int left;
-            int right;
-            cg::data_structures::Interval interval;
+            int intervalIndex;
+            int next;
         };
-        std::map<int, Range> _endpointToRange;
-        std::vector<std::list<cg::data_structures::Interval>> _intervalIndexToDirectlyContained; 
+        // Disjoint ranges of end-points, each owned by one interval, keyed by their right end. Positions are shifted by
+        // one so the sentinel range ending at -1 sits at position 0; a range's fields are only meaningful while its key is set.
+        cg::data_structures::SuccessorSet _rangeRights;
+        std::vector<int> _rangeRightToLeft;
+        std::vector<int> _rangeRightToIndex;
+        std::vector<cg::data_structures::Interval> _indexToInterval;
+        // The directly contained sets of all intervals share one arena of singly linked nodes, headed per interval index.
+        std::vector<int> _indexToContainedHead;
+        std::vector<ContainedNode> _containedArena;
+        int _lastRangeRight;
+        static int toPosition(int endpoint) { return endpoint + 1; }
+        static int toEndpoint(int position) { return position - 1; }
+        void insertRange(int left, int right, int intervalIndex);
+        [[nodiscard]] int nextRangeRight(int endpoint) const { return toEndpoint(_rangeRights.successor(toPosition(endpoint) + 1)); } // Smallest key > endpoint.
     public:
         ImplicitIndependentSet(int maxNumIntervals);
         void setRange(int left, int right, const cg::data_structures::Interval& interval);
         void assembleContainedIndependentSet(const cg::data_structures::Interval &interval);
         std::vector<cg::data_structures::Interval> buildIndependentSet(int expectedCardinality); 
     };
-}
\ No newline at end of file
+}
@@ -1,16 +1,27 @@
 #pragma once
 
 #include <vector>
-#include <map>
-#include <optional>
-#include <list>
+
+namespace cg::data_structures
+{
+    class Interval;
+}
 
 namespace cg::mis
 {
     class IndependentSet
     {
-        std::vector<std::optional<cg::data_structures::Interval>> _endpointToInterval;
-        std::vector<std::list<cg::data_structures::Interval>> _intervalIndexToDirectlyContained; 
+        static constexpr int NoInterval = -1;
+        struct ContainedNode
+        {
+            int intervalIndex;
+            int next;
+        };
+        std::vector<int> _endpointToNextIndex; // Index of the next interval in the solution starting at or after an end-point, or NoInterval.
+        std::vector<cg::data_structures::Interval> _indexToInterval;
+        // The directly contained sets of all intervals share one arena of singly linked nodes, headed per interval index.
+        std::vector<int> _indexToContainedHead;
+        std::vector<ContainedNode> _containedArena;
     public:
         IndependentSet(int maxNumIntervals);
         void setSameNextInterval(int where);
@@ -18,4 +29,4 @@ namespace cg::mis
         void assembleContainedIndependentSet(const cg::data_structures::Interval &interval);
         std::vector<cg::data_structures::Interval> buildIndependentSet(long expectedWeight); 
     };
-}
\ No newline at end of file
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <vector>
+
+namespace cg::data_structures
+{
+    class Interval;
+}
+
+namespace cg::mis
+{
+    // Stands in for IndependentSet or ImplicitIndependentSet when only the size of the MIS is wanted. Every
+    // solution-tracking call is an empty inline function, so the solvers' bookkeeping compiles away. The solvers'
+    // computeMISSize and tryComputeMISSize run with it and return the weight of a maximum weight independent set (its
+    // cardinality for unit weights) without building the set itself.
+    class NullIndependentSet
+    {
+    public:
+        explicit NullIndependentSet(int) {}
+        void setSameNextInterval(int) {}
+        void setNewNextInterval(int, const cg::data_structures::Interval&) {}
+        void setRange(int, int, const cg::data_structures::Interval&) {}
+        void assembleContainedIndependentSet(const cg::data_structures::Interval&) {}
+    };
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <vector>
+#include <limits>
+
+#include "mis/monotone_seq.h"
+
+namespace cg::mis
+{
+    // A drop-in replacement for MonotoneSeq that keeps the non-increasing sequence in a segment tree with lazy range
+    // assignment, so get and set take O(log n) regardless of how long the overwritten run is.
+    class SegmentTreeMonotoneSeq
+    {
+    private:
+        static constexpr int NoPending = std::numeric_limits<int>::min();
+        std::vector<int> _min;     // Minimum over each node's leaves, valid once the pending assignments above it are applied.
+        std::vector<int> _pending; // Value assigned to every leaf of the node, or NoPending.
+        int _size;
+        int _numLeaves;
+        void assignNode(int node, int value);
+        void pushDown(int node);
+        void assign(int node, int nodeLeft, int nodeRight, int left, int right, int value);
+        [[nodiscard]] int firstIndexBelow(int value) const; // Smallest index whose value is < value.
+        void collect(int node, int nodeLeft, int nodeRight, int inherited, std::vector<int> &target) const;
+    public:
+        using Range = MonotoneSeq::Range;
+        SegmentTreeMonotoneSeq(int size);
+        [[nodiscard]] int get(int idx);
+        Range set(int idx, int value);
+        void copyTo(std::vector<int>& target);
+    };
+}
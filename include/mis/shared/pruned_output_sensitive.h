@@ -10,11 +10,6 @@ namespace cg::utils
     template<typename TCounter> class Counters;
 }
 
-namespace cg::mis
-{
-    class IndependentSet;
-}
-
 namespace cg::data_structures
 {
     class Interval;
@@ -35,9 +30,14 @@ namespace cg::mis::shared
             NumMembers
         };
     private:
-        static bool tryUpdate(const cg::data_structures::SharedIntervalModel &intervals, std::stack<int> &pendingUpdates, IndependentSet& independentSet, std::vector<int> &MIS, std::vector<int> &CMIS, int maxAllowedMIS, cg::utils::Counters<Counts>& counts, std::vector<std::list<cg::data_structures::Interval>>& indexToRelevantIntervals);
+        template <typename TIndependentSet>
+        static bool tryUpdate(const cg::data_structures::SharedIntervalModel &intervals, std::stack<int> &pendingUpdates, TIndependentSet& independentSet, std::vector<int> &MIS, std::vector<int> &CMIS, int maxAllowedMIS, cg::utils::Counters<Counts>& counts, std::vector<std::list<cg::data_structures::Interval>>& indexToRelevantIntervals);
+        template <typename TIndependentSet>
+        static std::optional<int> tryComputeMISInternal(const cg::data_structures::SharedIntervalModel &intervals, TIndependentSet& independentSet, int maxAllowedMIS, cg::utils::Counters<Counts>& counts);
     public:
         
         static std::optional<std::vector<cg::data_structures::Interval>> tryComputeMIS(const cg::data_structures::SharedIntervalModel &intervals, int maxAllowedMIS, cg::utils::Counters<Counts>& counts);
+        // std::nullopt if the MIS weight exceeds maxAllowedMIS, as for tryComputeMIS.
+        static std::optional<int> tryComputeMISSize(const cg::data_structures::SharedIntervalModel &intervals, int maxAllowedMIS, cg::utils::Counters<Counts>& counts);
     };
 }
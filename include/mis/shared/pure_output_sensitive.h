@@ -9,11 +9,6 @@ namespace cg::utils
     template<typename TCounter> class Counters;
 }
 
-namespace cg::mis
-{
-    class IndependentSet;
-}
-
 namespace cg::data_structures
 {
     class Interval;
@@ -36,9 +31,14 @@ namespace cg::mis::shared
             NumMembers
         };
     private:
-        static bool tryUpdate(const cg::data_structures::SharedIntervalModel &intervals, std::stack<int> &pendingUpdates, IndependentSet& independentSet, const cg::data_structures::Interval &newInterval, std::vector<int> &MIS, std::vector<int> &CMIS, int maxAllowedMIS, cg::utils::Counters<Counts>& counts);
+        template <typename TIndependentSet>
+        static bool tryUpdate(const cg::data_structures::SharedIntervalModel &intervals, std::stack<int> &pendingUpdates, TIndependentSet& independentSet, const cg::data_structures::Interval &newInterval, std::vector<int> &MIS, std::vector<int> &CMIS, int maxAllowedMIS, cg::utils::Counters<Counts>& counts);
+        template <typename TIndependentSet>
+        static std::optional<int> tryComputeMISInternal(const cg::data_structures::SharedIntervalModel &intervals, TIndependentSet& independentSet, int maxAllowedMIS, cg::utils::Counters<Counts>& counts);
     public:
         
         static std::optional<std::vector<cg::data_structures::Interval>> tryComputeMIS(const cg::data_structures::SharedIntervalModel &intervals, int maxAllowedMIS, cg::utils::Counters<Counts>& counts);
+        // std::nullopt if the MIS weight exceeds maxAllowedMIS, as for tryComputeMIS.
+        static std::optional<int> tryComputeMISSize(const cg::data_structures::SharedIntervalModel &intervals, int maxAllowedMIS, cg::utils::Counters<Counts>& counts);
     };
 }
@@ -28,7 +28,10 @@ namespace cg::mis::shared
         };
     private:
         static std::optional<cg::data_structures::Interval> getMaxInterval(std::span<const cg::data_structures::Interval> intervals, int maxRightEndpoint, std::vector<int> &MIS, std::vector<int> &CMIS, cg::utils::Counters<Counts>& counts);
+        template <typename TIndependentSet>
+        static int computeMISInternal(const cg::data_structures::SharedIntervalModel &intervals, TIndependentSet &independentSet, cg::utils::Counters<Counts>& counts);
     public:
         static std::vector<cg::data_structures::Interval> computeMIS(const cg::data_structures::SharedIntervalModel &intervals, cg::utils::Counters<Counts>& counts);
+        static int computeMISSize(const cg::data_structures::SharedIntervalModel &intervals, cg::utils::Counters<Counts>& counts);
     };
 }
\ No newline at end of file
@@ -1,10 +1,42 @@
 #pragma once
 
+#include <array>
 #include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <new>
 #include <vector>
 
 namespace cg::utils
 {
+    // Allocator handing out storage aligned to a cache line, so that a table's first cell (and every tile of a
+    // tiled_array3) starts on a line boundary.
+    template <class T>
+    struct cache_aligned_allocator
+    {
+        using value_type = T;
+        static constexpr std::size_t alignment = 64;
+
+        cache_aligned_allocator() = default;
+        template <class U>
+        cache_aligned_allocator(const cache_aligned_allocator<U> &) {}
+
+        T *allocate(std::size_t count)
+        {
+            return static_cast<T *>(::operator new(count * sizeof(T), std::align_val_t{alignment}));
+        }
+        void deallocate(T *pointer, std::size_t)
+        {
+            ::operator delete(pointer, std::align_val_t{alignment});
+        }
+
+        template <class U>
+        bool operator==(const cache_aligned_allocator<U> &) const { return true; }
+    };
+
+    template <class T>
+    using aligned_vector = std::vector<T, cache_aligned_allocator<T>>;
+
     template <class T>
     struct array4
     {
@@ -28,7 +60,7 @@ namespace cg::utils
         int dim0 = 0;
         int dim1 = 0;
         int dim2 = 0;
-        std::vector<T> data;
+        aligned_vector<T> data;
 
         array3() = default;
 
@@ -44,12 +76,18 @@ namespace cg::utils
 
         T &operator()(int i, int j, int k)
         {
-            return data[static_cast<std::size_t>((i * dim1 + j) * dim2 + k)];
+            return data[offset(i, j, k)];
         }
 
         const T &operator()(int i, int j, int k) const
         {
-            return data[static_cast<std::size_t>((i * dim1 + j) * dim2 + k)];
+            return data[offset(i, j, k)];
+        }
+
+    private:
+        [[nodiscard]] std::size_t offset(int i, int j, int k) const
+        {
+            return static_cast<std::size_t>((static_cast<std::int64_t>(i) * dim1 + j) * dim2 + k);
         }
     };
 
@@ -58,7 +96,7 @@ namespace cg::utils
     {
         int dim0 = 0;
         int dim1 = 0;
-        std::vector<T> data;
+        aligned_vector<T> data;
 
         array2() = default;
 
@@ -74,13 +112,123 @@ namespace cg::utils
 
         T &operator()(int i, int j)
         {
-            return data[static_cast<std::size_t>(i * dim1 + j)];
+            return data[offset(i, j)];
         }
 
         const T &operator()(int i, int j) const
         {
-            return data[static_cast<std::size_t>(i * dim1 + j)];
+            return data[offset(i, j)];
+        }
+
+    private:
+        [[nodiscard]] std::size_t offset(int i, int j) const
+        {
+            return static_cast<std::size_t>(static_cast<std::int64_t>(i) * dim1 + j);
         }
     };
-}
 
+    // Memory order of the coordinates of a tiled_array3, outermost first: IJK is the row-major order of array3, IKJ
+    // stores (i, k, j) so that j is the contiguous coordinate, and so on.
+    enum class DimOrder
+    {
+        IJK,
+        IKJ,
+        JIK,
+        JKI,
+        KIJ,
+        KJI
+    };
+
+    // A drop-in alternative to array3 whose layout is chosen by the caller's loop nest. The coordinates are stored in
+    // the given DimOrder, and the two inner ones are blocked into square tiles of 2^TileBits x 2^TileBits cells, so
+    // a walk along either inner coordinate stays within a few cache lines and neighbouring rows share them. TileBits
+    // of 0 gives a plain permuted row-major layout. Dimensions are padded up to whole tiles.
+    template <class T, DimOrder Order = DimOrder::IJK, int TileBits = 3>
+    struct tiled_array3
+    {
+        static_assert(TileBits >= 0 && TileBits <= 8);
+
+        int dim0 = 0;
+        int dim1 = 0;
+        int dim2 = 0;
+        aligned_vector<T> data;
+
+        tiled_array3() = default;
+
+        tiled_array3(int d0, int d1, int d2, const T &empty)
+            : dim0(d0), dim1(d1), dim2(d2)
+        {
+            const auto stored = permute(d0, d1, d2);
+            _outer = stored[0];
+            _middleTiles = (stored[1] + tileMask) >> TileBits;
+            _innerTiles = (stored[2] + tileMask) >> TileBits;
+            data.assign(static_cast<std::size_t>(_outer * _middleTiles * _innerTiles) << (2 * TileBits), empty);
+        }
+
+        T &operator()(int i, int j, int k)
+        {
+            return data[offset(i, j, k)];
+        }
+
+        const T &operator()(int i, int j, int k) const
+        {
+            return data[offset(i, j, k)];
+        }
+
+    private:
+        static constexpr std::int64_t tileMask = (std::int64_t{1} << TileBits) - 1;
+
+        [[nodiscard]] static constexpr std::array<std::int64_t, 3> permute(std::int64_t i, std::int64_t j, std::int64_t k)
+        {
+            switch (Order)
+            {
+            case DimOrder::IJK:
+                return {i, j, k};
+            case DimOrder::IKJ:
+                return {i, k, j};
+            case DimOrder::JIK:
+                return {j, i, k};
+            case DimOrder::JKI:
+                return {j, k, i};
+            case DimOrder::KIJ:
+                return {k, i, j};
+            case DimOrder::KJI:
+                return {k, j, i};
+            }
+            return {i, j, k};
+        }
+
+        [[nodiscard]] std::size_t offset(int i, int j, int k) const
+        {
+            const auto [outer, middle, inner] = permute(i, j, k);
+            if constexpr (TileBits == 0)
+            {
+                return static_cast<std::size_t>((outer * _middleTiles + middle) * _innerTiles + inner);
+            }
+            const auto tile = (outer * _middleTiles + (middle >> TileBits)) * _innerTiles + (inner >> TileBits);
+            const auto inTile = ((middle & tileMask) << TileBits) | (inner & tileMask);
+            return static_cast<std::size_t>((tile << (2 * TileBits)) | inTile);
+        }
+
+        std::int64_t _outer = 0;
+        std::int64_t _middleTiles = 0;
+        std::int64_t _innerTiles = 0;
+    };
+
+    // Calls f with a value of the narrowest cell type that can hold every integer in [0, maxValue]: std::uint8_t,
+    // std::uint16_t or int. DP score tables bounded by the input size use it to pick their cell type at run time,
+    // f being a generic lambda that instantiates the DP for the given type.
+    template <class F>
+    decltype(auto) withNarrowestCell(std::size_t maxValue, F &&f)
+    {
+        if (maxValue <= std::numeric_limits<std::uint8_t>::max())
+        {
+            return f(std::uint8_t{});
+        }
+        if (maxValue <= std::numeric_limits<std::uint16_t>::max())
+        {
+            return f(std::uint16_t{});
+        }
+        return f(int{});
+    }
+}
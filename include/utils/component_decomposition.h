@@ -0,0 +1,76 @@
+#pragma once
+
+#include <algorithm>
+#include <numeric>
+#include <span>
+#include <vector>
+
+#include "data_structures/interval.h"
+#include "data_structures/distinct_interval_model.h"
+#include "utils/thread_pool.h"
+
+namespace cg::components
+{
+    // One connected component of a circle graph as a model of its own: end-points renumbered densely in
+    // [0, 2 * size) preserving their order, indices dense in [0, size) by increasing left end-point, weights kept.
+    // originalIndex maps a component index back to the Interval::Index it had in the full model.
+    struct Component
+    {
+        cg::data_structures::DistinctIntervalModel model;
+        std::vector<int> originalIndex;
+    };
+
+    // Splits the model into its connected components (getConnectedComponents), largest first.
+    [[nodiscard]] std::vector<Component> decompose(const cg::data_structures::DistinctIntervalModel &intervalModel);
+
+    // MIS and MIF of a disconnected circle graph are the unions of those of its components, and the MIF DPs are
+    // polynomials of high degree in the model size, so solving the components separately is never slower and usually
+    // much faster. solvePerComponent runs solve(const DistinctIntervalModel &) -> std::vector<Interval> on every
+    // component, on threadCount threads (values below 1 mean all hardware threads; solve must then be safe to call
+    // concurrently), and returns the union of the picked intervals as they appear in the full model, by increasing
+    // index. sumPerComponent does the same for solvers returning a size or weight.
+    template <class TSolve>
+    [[nodiscard]] std::vector<cg::data_structures::Interval> solvePerComponent(const cg::data_structures::DistinctIntervalModel &intervalModel, int threadCount, TSolve &&solve)
+    {
+        const auto components = decompose(intervalModel);
+        std::vector<std::vector<cg::data_structures::Interval>> picked(components.size());
+        cg::utils::ThreadPool pool(threadCount);
+        pool.parallelFor(static_cast<int>(components.size()), 1, [&](int begin, int end)
+        {
+            for (int c = begin; c < end; ++c)
+            {
+                picked[c] = solve(components[c].model);
+            }
+        });
+
+        std::vector<cg::data_structures::Interval> result;
+        for (std::size_t c = 0; c < components.size(); ++c)
+        {
+            for (const auto &interval : picked[c])
+            {
+                result.push_back(intervalModel.getIntervalByIndex(components[c].originalIndex[interval.Index]));
+            }
+        }
+        std::sort(result.begin(), result.end(), [](const auto &lhs, const auto &rhs)
+        {
+            return lhs.Index < rhs.Index;
+        });
+        return result;
+    }
+
+    template <class TSolve>
+    [[nodiscard]] long long sumPerComponent(const cg::data_structures::DistinctIntervalModel &intervalModel, int threadCount, TSolve &&solve)
+    {
+        const auto components = decompose(intervalModel);
+        std::vector<long long> values(components.size(), 0);
+        cg::utils::ThreadPool pool(threadCount);
+        pool.parallelFor(static_cast<int>(components.size()), 1, [&](int begin, int end)
+        {
+            for (int c = begin; c < end; ++c)
+            {
+                values[c] = solve(components[c].model);
+            }
+        });
+        return std::accumulate(values.begin(), values.end(), 0LL);
+    }
+}
@@ -12,4 +12,13 @@ namespace cg::components
 {
     std::vector<std::vector<cg::data_structures::Interval>> getConnectedComponents(std::span<const cg::data_structures::Interval> intervals);
     std::vector<std::vector<cg::data_structures::Interval>> getConnectedComponentsNaive(std::span<const cg::data_structures::Interval> intervals);
-}
\ No newline at end of file
+
+    // The connected components as flat labels: labels[i] is the component of intervals[i], and components are numbered
+    // 0..numComponents-1 in order of their leftmost end-point.
+    struct ComponentLabels
+    {
+        int numComponents = 0;
+        std::vector<int> labels;
+    };
+    ComponentLabels getConnectedComponentLabels(std::span<const cg::data_structures::Interval> intervals);
+}
@@ -0,0 +1,57 @@
+#pragma once
+#include <algorithm>
+#include <cassert>
+#include <limits>
+#include <span>
+#include <vector>
+
+namespace cg::utils
+{
+    // The same prefix-max Fenwick tree as FenwickMax for hot loops that already guarantee valid indices: bounds are
+    // only asserted (so checked in Debug, free in Release) and the point update and query are inline. It adds an
+    // O(n) bulk build and a batched query that shares work between queries whose tree paths overlap.
+    class FastFenwickMax
+    {
+    public:
+        explicit FastFenwickMax(int n = 0, int negInf = std::numeric_limits<int>::min());
+
+        int size() const { return N; }
+
+        // Replace the contents with values (values.size() == N) in O(N), as if each were set in turn on an empty tree.
+        void build(std::span<const int> values);
+
+        // Monotone point update: a[idx] = max(a[idx], value), 0 <= idx < N
+        void setIdx(int idx, int value)
+        {
+            assert(idx >= 0 && idx < N);
+            for (int i = idx + 1; i <= N; i += lowbit(i))
+            {
+                bit[static_cast<size_t>(i)] = std::max(bit[static_cast<size_t>(i)], value);
+            }
+        }
+
+        // Prefix max over a[0..idx], 0 <= idx < N.
+        int prefixMaxInclusive(int idx) const
+        {
+            assert(idx >= 0 && idx < N);
+            int res = neutral;
+            for (int i = idx + 1; i > 0; i -= lowbit(i))
+            {
+                res = std::max(res, bit[static_cast<size_t>(i)]);
+            }
+            return res;
+        }
+
+        // results[k] = prefixMaxInclusive(indices[k]). Any order is correct, but sorted indices are fastest: consecutive
+        // queries then share the high end of their tree paths and only the differing tail is read.
+        void prefixMaxInclusive(std::span<const int> indices, std::span<int> results) const;
+
+    private:
+        static int lowbit(int x) { return x & -x; }
+
+    private:
+        int N;
+        int neutral;
+        std::vector<int> bit; // 1..N; bit[i] covers (i - lowbit(i) + 1) .. i
+    };
+}
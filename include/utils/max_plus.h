@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstdint>
+
+namespace cg::utils
+{
+    // Instruction sets the max-plus kernels can run on, in increasing order of width. AVX-512 needs both the F and
+    // BW extensions, since the narrow cell types use byte and word lanes.
+    enum class SimdLevel
+    {
+        Scalar,
+        Sse41,
+        Avx2,
+        Avx512
+    };
+
+    // The widest level this CPU (and OS) supports; detected once.
+    [[nodiscard]] SimdLevel supportedSimdLevel();
+
+    // The level the kernels currently dispatch to; it starts at supportedSimdLevel().
+    [[nodiscard]] SimdLevel activeSimdLevel();
+
+    // Caps the level the kernels dispatch to, for benchmarks and tests; requests above supportedSimdLevel() are
+    // clamped. Returns the level now active.
+    SimdLevel setSimdLevel(SimdLevel level);
+
+    struct MaxPlusResult
+    {
+        int value = 0;
+        int index = -1;
+    };
+
+    // Vertical max-plus reductions over two contiguous ranges of DP cells: the largest a[i] + b[i] over
+    // 0 <= i < count, and for argMaxPlus also the first index attaining it, which matches a serial scan that only
+    // replaces its best on a strictly greater value. count must be at least 1. The unsigned cell types add with
+    // saturation at their maximum, which is exact whenever the true sum fits the type, as it does for forest sizes
+    // bounded by the number of intervals.
+    [[nodiscard]] int maxPlus(const std::uint8_t *a, const std::uint8_t *b, int count);
+    [[nodiscard]] int maxPlus(const std::uint16_t *a, const std::uint16_t *b, int count);
+    [[nodiscard]] int maxPlus(const int *a, const int *b, int count);
+
+    [[nodiscard]] MaxPlusResult argMaxPlus(const std::uint8_t *a, const std::uint8_t *b, int count);
+    [[nodiscard]] MaxPlusResult argMaxPlus(const std::uint16_t *a, const std::uint16_t *b, int count);
+    [[nodiscard]] MaxPlusResult argMaxPlus(const int *a, const int *b, int count);
+}
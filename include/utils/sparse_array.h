@@ -0,0 +1,193 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace cg::utils
+{
+    // Sparse counterparts of array3/array4 for tables whose last coordinate is a layer index and where only a
+    // small fraction of the cells are ever written. Each layer owns a hash map keyed on the remaining coordinates,
+    // packed into a single integer. Reading a cell that was never written yields the 'empty' value without
+    // inserting it, so writes must go through set(). A layer that will not be written again can be frozen into a
+    // sorted flat array, which is read by binary search and takes a fraction of the hash map's memory.
+    template <class T>
+    struct sparse_array4
+    {
+        std::size_t n = 0;
+        T empty{};
+        std::vector<std::unordered_map<std::uint64_t, T>> layers;
+        std::vector<std::vector<std::pair<std::uint64_t, T>>> frozenLayers;
+
+        sparse_array4() = default;
+        explicit sparse_array4(std::size_t n, const T &empty) : n(n), empty(empty) {}
+
+        const T &operator()(std::size_t i, std::size_t j, std::size_t k, std::size_t l) const
+        {
+            if (l >= layers.size())
+            {
+                return empty;
+            }
+            const auto cellKey = key(i, j, k);
+            const auto &frozen = frozenLayers[l];
+            if (!frozen.empty())
+            {
+                const auto it = std::lower_bound(frozen.begin(), frozen.end(), cellKey, [](const auto &entry, std::uint64_t key)
+                {
+                    return entry.first < key;
+                });
+                return it == frozen.end() || it->first != cellKey ? empty : it->second;
+            }
+            const auto &layer = layers[l];
+            const auto it = layer.find(cellKey);
+            return it == layer.end() ? empty : it->second;
+        }
+
+        void set(std::size_t i, std::size_t j, std::size_t k, std::size_t l, const T &value)
+        {
+            if (l >= layers.size())
+            {
+                layers.resize(l + 1);
+                frozenLayers.resize(l + 1);
+            }
+            assert(frozenLayers[l].empty());
+            layers[l].insert_or_assign(key(i, j, k), value);
+        }
+
+        // Drops every cell of layer l and releases its storage; later reads of the layer yield 'empty'.
+        void clearLayer(std::size_t l)
+        {
+            if (l < layers.size())
+            {
+                std::unordered_map<std::uint64_t, T>().swap(layers[l]);
+                std::vector<std::pair<std::uint64_t, T>>().swap(frozenLayers[l]);
+            }
+        }
+
+        // Moves layer l into its sorted flat form. The layer must not be written afterwards.
+        void freezeLayer(std::size_t l)
+        {
+            if (l >= layers.size() || layers[l].empty())
+            {
+                return;
+            }
+            auto &frozen = frozenLayers[l];
+            frozen.assign(layers[l].begin(), layers[l].end());
+            std::sort(frozen.begin(), frozen.end(), [](const auto &lhs, const auto &rhs)
+            {
+                return lhs.first < rhs.first;
+            });
+            std::unordered_map<std::uint64_t, T>().swap(layers[l]);
+        }
+
+        // Number of cells that have been written.
+        [[nodiscard]] std::size_t size() const
+        {
+            std::size_t total = 0;
+            for (std::size_t l = 0; l < layers.size(); ++l)
+            {
+                total += layers[l].size() + frozenLayers[l].size();
+            }
+            return total;
+        }
+
+        // Approximate heap footprint: one node (next pointer plus key/value pair) per hashed entry plus the bucket
+        // arrays, and the flat arrays of frozen layers.
+        [[nodiscard]] std::size_t memoryBytes() const
+        {
+            std::size_t total = layers.capacity() * sizeof(layers[0]) + frozenLayers.capacity() * sizeof(frozenLayers[0]);
+            for (std::size_t l = 0; l < layers.size(); ++l)
+            {
+                total += layers[l].bucket_count() * sizeof(void *) + layers[l].size() * (sizeof(void *) + sizeof(std::pair<const std::uint64_t, T>));
+                total += frozenLayers[l].capacity() * sizeof(frozenLayers[l][0]);
+            }
+            return total;
+        }
+
+        // Bytes the equivalent dense array4 would allocate.
+        [[nodiscard]] std::size_t denseBytes() const
+        {
+            return n * n * n * n * sizeof(T);
+        }
+
+    private:
+        [[nodiscard]] std::uint64_t key(std::size_t i, std::size_t j, std::size_t k) const
+        {
+            return (static_cast<std::uint64_t>(i) * n + j) * n + k;
+        }
+    };
+
+    template <class T>
+    struct sparse_array3
+    {
+        std::size_t n = 0;
+        T empty{};
+        std::vector<std::unordered_map<std::uint64_t, T>> layers;
+
+        sparse_array3() = default;
+        explicit sparse_array3(std::size_t n, const T &empty) : n(n), empty(empty) {}
+
+        const T &operator()(std::size_t i, std::size_t j, std::size_t l) const
+        {
+            if (l >= layers.size())
+            {
+                return empty;
+            }
+            const auto &layer = layers[l];
+            const auto it = layer.find(key(i, j));
+            return it == layer.end() ? empty : it->second;
+        }
+
+        void set(std::size_t i, std::size_t j, std::size_t l, const T &value)
+        {
+            if (l >= layers.size())
+            {
+                layers.resize(l + 1);
+            }
+            layers[l].insert_or_assign(key(i, j), value);
+        }
+
+        void clearLayer(std::size_t l)
+        {
+            if (l < layers.size())
+            {
+                std::unordered_map<std::uint64_t, T>().swap(layers[l]);
+            }
+        }
+
+        [[nodiscard]] std::size_t size() const
+        {
+            std::size_t total = 0;
+            for (const auto &layer : layers)
+            {
+                total += layer.size();
+            }
+            return total;
+        }
+
+        [[nodiscard]] std::size_t memoryBytes() const
+        {
+            std::size_t total = layers.capacity() * sizeof(layers[0]);
+            for (const auto &layer : layers)
+            {
+                total += layer.bucket_count() * sizeof(void *) + layer.size() * (sizeof(void *) + sizeof(std::pair<const std::uint64_t, T>));
+            }
+            return total;
+        }
+
+        [[nodiscard]] std::size_t denseBytes() const
+        {
+            return n * n * n * sizeof(T);
+        }
+
+    private:
+        [[nodiscard]] std::uint64_t key(std::size_t i, std::size_t j) const
+        {
+            return static_cast<std::uint64_t>(i) * n + j;
+        }
+    };
+}
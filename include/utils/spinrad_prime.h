@@ -1,19 +1,35 @@
 #pragma once
 
 #include "data_structures/graph.h"
+#include "data_structures/csr_graph.h"
 #include <vector>
 #include <tuple>
 #include <optional>
 
 namespace cg::utils
 {
-    class Forest;
-
+    // Runs on any AdjacencyGraph; the member templates are instantiated for Graph and CsrGraph in spinrad_prime.cpp.
     class SpinradPrime
     {
-            std::vector<Forest> getDividedForests(const cg::data_structures::Graph& g, const cg::data_structures::Graph::Vertex& a, const cg::data_structures::Graph::Vertex& b);
+            // The vertex sets of the forests left once the forests grown from {a, b} cannot be divided further, forest i
+            // being vertices[forestBegin[i], forestBegin[i + 1]).
+            struct DividedForests
+            {
+                std::vector<int> vertices;
+                std::vector<int> forestBegin;
+            };
+
+            template <cg::data_structures::AdjacencyGraph TGraph>
+            DividedForests getDividedForests(const TGraph& g, const typename TGraph::Vertex& a, const typename TGraph::Vertex& b);
         public:
-            std::optional<std::tuple<std::vector<int>, std::vector<int>>> trySplit(const cg::data_structures::Graph& graph);
-            void verifySplit(const cg::data_structures::Graph& graph, std::vector<int>& v1, std::vector<int>& v2);
+            template <cg::data_structures::AdjacencyGraph TGraph>
+            std::optional<std::tuple<std::vector<int>, std::vector<int>>> trySplit(const TGraph& graph);
+            template <cg::data_structures::AdjacencyGraph TGraph>
+            void verifySplit(const TGraph& graph, std::vector<int>& v1, std::vector<int>& v2);
     };
+
+    extern template std::optional<std::tuple<std::vector<int>, std::vector<int>>> SpinradPrime::trySplit(const cg::data_structures::Graph& graph);
+    extern template std::optional<std::tuple<std::vector<int>, std::vector<int>>> SpinradPrime::trySplit(const cg::data_structures::CsrGraph& graph);
+    extern template void SpinradPrime::verifySplit(const cg::data_structures::Graph& graph, std::vector<int>& v1, std::vector<int>& v2);
+    extern template void SpinradPrime::verifySplit(const cg::data_structures::CsrGraph& graph, std::vector<int>& v1, std::vector<int>& v2);
 }
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <vector>
+
+#include "data_structures/csr_graph.h"
+
+namespace cg::utils
+{
+    enum class SplitNodeType
+    {
+        Prime,
+        Clique,
+        Star
+    };
+
+    // One node of a split tree: a graph on some original vertices and some marker vertices. Local vertex i of
+    // 'graph' is vertices[i], an original vertex when below SplitTree::numVertices() and a marker otherwise. A star's
+    // centre is the vertex 'centre' (also a global label); for other node types centre is NoVertex.
+    struct SplitTreeNode
+    {
+        static constexpr int NoVertex = -1;
+
+        SplitNodeType type;
+        std::vector<int> vertices;
+        cg::data_structures::CsrGraph graph;
+        int centre = NoVertex;
+    };
+
+    // The (reduced) split decomposition of a connected graph. Every marker vertex is paired with the marker of the
+    // neighbouring node at the other end of a tree edge, and two original vertices are adjacent in the graph exactly
+    // when the tree path between their nodes alternates graph edges and tree edges: the first vertex is adjacent to
+    // the marker leaving its node, each node on the way joins its two markers by an edge, and the last marker is
+    // adjacent to the second vertex. No two clique nodes are neighbours, nor two star nodes joined from the centre
+    // of one to a leaf of the other, which makes the tree unique.
+    class SplitTree
+    {
+        int _numVertices;
+        std::vector<SplitTreeNode> _nodes;
+        std::vector<int> _markerPartner;
+        std::vector<int> _markerNode;
+
+    public:
+        SplitTree(int numVertices, std::vector<SplitTreeNode> nodes, std::vector<int> markerPartner);
+
+        // Number of vertices of the decomposed graph; markers are labelled from here on.
+        [[nodiscard]] int numVertices() const { return _numVertices; }
+        [[nodiscard]] const std::vector<SplitTreeNode> &nodes() const { return _nodes; }
+
+        [[nodiscard]] bool isMarker(int vertex) const { return vertex >= _numVertices; }
+        [[nodiscard]] int partner(int marker) const { return _markerPartner[marker - _numVertices]; }
+        [[nodiscard]] int nodeOfMarker(int marker) const { return _markerNode[marker - _numVertices]; }
+    };
+
+    // Builds the split tree with SpinradPrime. A graph that is a clique or a star becomes a degenerate node. Any
+    // other graph is either prime (trySplit finds no split) or split as (V1, V2) into G[V1] and G[V2], each with a
+    // new marker joined to the vertices that have neighbours on the other side, and both halves are decomposed in
+    // turn. Every split adds one node and there are at most n - 2 nodes, so trySplit runs at most 2n times, each
+    // time on a graph with fewer vertices than the input and at most n more edges. Each call is O(n (n + m)), so the
+    // whole decomposition is O(n^2 (n + m)) in the worst case (a chain of unbalanced splits), and O(n (n + m)) times
+    // the depth of the tree in general. Finally, adjacent clique nodes and centre-to-leaf adjacent star nodes are
+    // merged. The pending halves of a round are independent and run on threadCount threads
+    // (values below 1 mean all hardware threads). Throws std::invalid_argument when the graph is not connected.
+    class SplitDecomposition
+    {
+    public:
+        [[nodiscard]] static SplitTree decompose(const cg::data_structures::CsrGraph &graph, int threadCount = 1);
+    };
+}
@@ -0,0 +1,104 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace cg::utils
+{
+    // A fixed set of worker threads for data-parallel loops inside the DP solvers. parallelFor hands out chunks of
+    // an index range through an atomic counter, the calling thread takes chunks too, and it returns once every chunk
+    // has run, so consecutive calls act as barriers. Which thread runs a chunk is not deterministic, so the body must
+    // only write cells owned by its own indices.
+    class ThreadPool
+    {
+    public:
+        // threadCount includes the calling thread; values below 1 mean std::thread::hardware_concurrency().
+        explicit ThreadPool(int threadCount);
+        ~ThreadPool();
+
+        ThreadPool(const ThreadPool &) = delete;
+        ThreadPool &operator=(const ThreadPool &) = delete;
+
+        [[nodiscard]] int threadCount() const { return static_cast<int>(_workers.size()) + 1; }
+
+        // Calls body(begin, end) on disjoint chunks covering [0, count), each at most chunkSize long. The first
+        // exception thrown by a chunk is rethrown here once all chunks have finished. Work that fits in one chunk,
+        // or a pool without workers, runs inline on the calling thread.
+        template <typename TBody>
+        void parallelFor(int count, int chunkSize, TBody &&body)
+        {
+            if (count <= 0)
+            {
+                return;
+            }
+            chunkSize = std::max(1, chunkSize);
+            if (_workers.empty() || count <= chunkSize)
+            {
+                body(0, count);
+                return;
+            }
+            runParallel(count, chunkSize, std::function<void(int, int)>(std::ref(body)));
+        }
+
+        // A chunk size giving each thread several chunks of the 'count' live indices, to balance uneven cells, but
+        // never below minChunkSize so that cheap indices are not split finer than the synchronisation is worth.
+        [[nodiscard]] int chunkSizeFor(int count, int minChunkSize = 1) const;
+
+        // Max-reduction over [0, count): body(begin, end, initial, initialChoice) scans its indices in order, replaces
+        // the running best only on a strictly greater candidate and returns {best, choice}. The per-chunk winners are
+        // merged in index order with the same rule, so the result is exactly what one serial scan of [0, count) would
+        // give, whatever the thread count.
+        template <typename TChoice, typename TBody>
+        std::pair<int, TChoice> argMax(int count, int chunkSize, int initial, const TChoice &initialChoice, TBody &&body)
+        {
+            chunkSize = std::max(1, chunkSize);
+            if (_workers.empty() || count <= chunkSize)
+            {
+                return body(0, std::max(0, count), initial, initialChoice);
+            }
+            std::vector<std::pair<int, TChoice>> partial((count + chunkSize - 1) / chunkSize);
+            parallelFor(count, chunkSize, [&](int begin, int end)
+            {
+                partial[begin / chunkSize] = body(begin, end, initial, initialChoice);
+            });
+            std::pair<int, TChoice> result{initial, initialChoice};
+            for (const auto &chunkResult : partial)
+            {
+                if (chunkResult.first > result.first)
+                {
+                    result = chunkResult;
+                }
+            }
+            return result;
+        }
+
+        [[nodiscard]] static int resolveThreadCount(int threadCount);
+
+    private:
+        void runParallel(int count, int chunkSize, const std::function<void(int, int)> &body);
+        void workerLoop();
+        void runChunks();
+
+        std::vector<std::thread> _workers;
+        std::mutex _mutex;
+        std::condition_variable _wake;
+        std::condition_variable _done;
+        std::size_t _generation = 0;
+        std::size_t _busyWorkers = 0;
+        bool _stopping = false;
+
+        const std::function<void(int, int)> *_body = nullptr;
+        int _count = 0;
+        int _chunkSize = 1;
+        std::atomic<int> _nextIndex = 0;
+        std::exception_ptr _error;
+    };
+}
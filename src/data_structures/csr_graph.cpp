@@ -0,0 +1,269 @@
+#include "data_structures/csr_graph.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+
+#include "data_structures/interval.h"
+#include "data_structures/distinct_interval_model.h"
+#include "data_structures/chord_model.h"
+#include "utils/thread_pool.h"
+
+namespace cg::data_structures
+{
+    namespace
+    {
+        // Appends every crossing pair {i, j} with Left(i) < Left(j) whose right end-point Right(i) lies in
+        // [begin, end). The intervals open at the current end-point are a doubly linked list (next / previous
+        // index) in left end-point order, seeded with the intervals open at 'begin'. Only the part after i is ever
+        // walked, so the list needs no head.
+        void sweepCrossings(const DistinctIntervalModel &intervalModel, int begin, int end, std::vector<std::pair<int, int>> &edges)
+        {
+            constexpr auto None = -1;
+            std::vector<int> next(intervalModel.size, None);
+            std::vector<int> previous(intervalModel.size, None);
+            auto tail = None;
+            const auto append = [&](int i)
+            {
+                previous[i] = tail;
+                if (tail != None)
+                {
+                    next[tail] = i;
+                }
+                tail = i;
+            };
+
+            for (const auto &interval : intervalModel.allIntervals())
+            {
+                if (interval.Left >= begin)
+                {
+                    break;
+                }
+                if (interval.Right >= begin)
+                {
+                    append(interval.Index);
+                }
+            }
+
+            for (auto e = begin; e < end; ++e)
+            {
+                const auto i = intervalModel.intervalIndexAt(e);
+                if (intervalModel.isLeftEndpoint(e))
+                {
+                    append(i);
+                    continue;
+                }
+                for (auto j = next[i]; j != None; j = next[j])
+                {
+                    edges.emplace_back(i, j);
+                }
+                if (previous[i] != None)
+                {
+                    next[previous[i]] = next[i];
+                }
+                (next[i] == None ? tail : previous[next[i]]) = previous[i];
+            }
+        }
+    }
+
+    CsrGraph::Builder::Builder(int numVertices) : _numVertices(numVertices)
+    {
+        if (numVertices < 0)
+        {
+            throw std::invalid_argument("Number of vertices must be non-negative");
+        }
+    }
+
+    void CsrGraph::Builder::reserve(std::size_t numEdges)
+    {
+        _edges.reserve(numEdges);
+    }
+
+    void CsrGraph::Builder::addEdge(Vertex u, Vertex v)
+    {
+        if (u < 0 || u >= _numVertices || v < 0 || v >= _numVertices)
+        {
+            throw std::out_of_range("Vertex index out of range");
+        }
+        _edges.emplace_back(u, v);
+    }
+
+    CsrGraph CsrGraph::Builder::build() const
+    {
+        return fromEdgeChunks(_numVertices, std::span(&_edges, 1));
+    }
+
+    CsrGraph CsrGraph::fromEdgeChunks(int numVertices, std::span<const std::vector<std::pair<Vertex, Vertex>>> edgeChunks)
+    {
+        // Counting sort of the edge ends by source vertex, in edge order within each row.
+        std::vector<std::size_t> offsets(numVertices + 1, 0);
+        for (const auto &edges : edgeChunks)
+        {
+            for (const auto &[u, v] : edges)
+            {
+                ++offsets[u + 1];
+                if (u != v)
+                {
+                    ++offsets[v + 1];
+                }
+            }
+        }
+        for (auto v = 0; v < numVertices; ++v)
+        {
+            offsets[v + 1] += offsets[v];
+        }
+
+        std::vector<Vertex> unsorted(offsets[numVertices]);
+        std::vector<std::size_t> next(offsets.begin(), offsets.end() - 1);
+        for (const auto &edges : edgeChunks)
+        {
+            for (const auto &[u, v] : edges)
+            {
+                unsorted[next[u]++] = v;
+                if (u != v)
+                {
+                    unsorted[next[v]++] = u;
+                }
+            }
+        }
+
+        // The rows are symmetric, so walking them in vertex order and appending v to the row of each of its
+        // neighbours refills every row in increasing order, with repeated edges next to each other.
+        std::vector<Vertex> adjacency(unsorted.size());
+        std::copy(offsets.begin(), offsets.end() - 1, next.begin());
+        for (auto v = 0; v < numVertices; ++v)
+        {
+            for (auto i = offsets[v]; i < offsets[v + 1]; ++i)
+            {
+                adjacency[next[unsorted[i]]++] = v;
+            }
+        }
+        unsorted = {};
+
+        std::size_t size = 0;
+        std::size_t begin = 0;
+        for (auto v = 0; v < numVertices; ++v)
+        {
+            const auto end = offsets[v + 1];
+            offsets[v] = size;
+            for (auto i = begin; i < end; ++i)
+            {
+                if (i == begin || adjacency[i] != adjacency[i - 1])
+                {
+                    adjacency[size++] = adjacency[i];
+                }
+            }
+            begin = end;
+        }
+        offsets[numVertices] = size;
+        adjacency.resize(size);
+        adjacency.shrink_to_fit();
+        return CsrGraph(std::move(offsets), std::move(adjacency));
+    }
+
+    CsrGraph CsrGraph::fromIntervalModel(const DistinctIntervalModel &intervalModel, int threadCount)
+    {
+        threadCount = cg::utils::ThreadPool::resolveThreadCount(threadCount);
+        // A few ranges per thread, as the crossings are rarely spread evenly over the end-points.
+        const auto numRanges = std::min(intervalModel.end, threadCount == 1 ? 1 : 4 * threadCount);
+        std::vector<std::vector<std::pair<Vertex, Vertex>>> edgeChunks(std::max(numRanges, 0));
+
+        cg::utils::ThreadPool pool(threadCount);
+        pool.parallelFor(numRanges, 1, [&](int rangeBegin, int rangeEnd)
+        {
+            for (auto range = rangeBegin; range < rangeEnd; ++range)
+            {
+                const auto begin = static_cast<int>(static_cast<std::int64_t>(intervalModel.end) * range / numRanges);
+                const auto end = static_cast<int>(static_cast<std::int64_t>(intervalModel.end) * (range + 1) / numRanges);
+                sweepCrossings(intervalModel, begin, end, edgeChunks[range]);
+            }
+        });
+        return fromEdgeChunks(intervalModel.size, edgeChunks);
+    }
+
+    CsrGraph CsrGraph::fromChordModel(const ChordModel &chordModel, int threadCount)
+    {
+        return fromIntervalModel(chordModel.toDistinctIntervalModel(), threadCount);
+    }
+
+    CsrGraph::CsrGraph(std::vector<std::size_t> offsets, std::vector<Vertex> adjacency) : _offsets(std::move(offsets)), _adjacency(std::move(adjacency))
+    {
+        buildMatrixIfDense();
+    }
+
+    void CsrGraph::buildMatrixIfDense()
+    {
+        const auto n = static_cast<std::size_t>(numVertices());
+        _matrixWordsPerRow = (n + 63) / 64;
+        if (n * _matrixWordsPerRow * sizeof(std::uint64_t) > _adjacency.size() * sizeof(Vertex))
+        {
+            return;
+        }
+        _matrix.assign(n * _matrixWordsPerRow, 0);
+        for (std::size_t v = 0; v < n; ++v)
+        {
+            for (auto i = _offsets[v]; i < _offsets[v + 1]; ++i)
+            {
+                _matrix[v * _matrixWordsPerRow + _adjacency[i] / 64] |= std::uint64_t{1} << (_adjacency[i] % 64);
+            }
+        }
+    }
+
+    CsrGraph::CsrGraph(const Graph &graph) : _offsets(graph.numVertices() + 1, 0)
+    {
+        for (auto v = 0; v < graph.numVertices(); ++v)
+        {
+            _offsets[v + 1] = _offsets[v] + graph.neighbours(v).size();
+        }
+        _adjacency.resize(_offsets.back());
+        for (auto v = 0; v < graph.numVertices(); ++v)
+        {
+            const auto &neighbours = graph.neighbours(v);
+            const auto first = _adjacency.begin() + static_cast<std::ptrdiff_t>(_offsets[v]);
+            std::sort(first, std::copy(neighbours.begin(), neighbours.end(), first));
+        }
+        buildMatrixIfDense();
+    }
+
+    int CsrGraph::numVertices() const
+    {
+        return static_cast<int>(_offsets.size()) - 1;
+    }
+
+    std::size_t CsrGraph::numEdgeEnds() const
+    {
+        return _adjacency.size();
+    }
+
+    CsrGraph::Neighbours CsrGraph::neighbours(Vertex v) const
+    {
+        if (v < 0 || v >= numVertices())
+        {
+            throw std::out_of_range("Vertex index out of range");
+        }
+        return Neighbours(_adjacency.data() + _offsets[v], _offsets[v + 1] - _offsets[v]);
+    }
+
+    int CsrGraph::degree(Vertex v) const
+    {
+        return static_cast<int>(neighbours(v).size());
+    }
+
+    bool CsrGraph::hasEdge(Vertex u, Vertex v) const
+    {
+        const auto uNeighbours = neighbours(u);
+        const auto vNeighbours = neighbours(v);
+        if (!_matrix.empty())
+        {
+            return (_matrix[static_cast<std::size_t>(u) * _matrixWordsPerRow + v / 64] >> (v % 64)) & 1;
+        }
+        return uNeighbours.size() <= vNeighbours.size()
+            ? std::binary_search(uNeighbours.begin(), uNeighbours.end(), v)
+            : std::binary_search(vNeighbours.begin(), vNeighbours.end(), u);
+    }
+
+    std::size_t CsrGraph::memoryBytes() const
+    {
+        return _offsets.capacity() * sizeof(std::size_t) + _adjacency.capacity() * sizeof(Vertex) + _matrix.capacity() * sizeof(std::uint64_t);
+    }
+}
@@ -14,42 +14,70 @@ namespace cg::data_structures
         cg::interval_model_utils::verifyEndpointsInRange(intervals);
         cg::interval_model_utils::verifyEndpointsUnique(intervals);
         cg::interval_model_utils::verifyIndicesDense(intervals);
-        _leftEndpointToInterval = std::vector<std::optional<Interval>>(end);
-        _rightEndpointToInterval = std::vector<std::optional<Interval>>(end);
-        _indexToInterval = std::vector<Interval>();
-        _indexToInterval.reserve(size);
+        _endpointToPartner = std::vector<std::int32_t>(end, NoEndpoint);
+        _endpointToIndex = std::vector<std::int32_t>(end, NoEndpoint);
+        _indexToLeft = std::vector<std::int32_t>(size, NoEndpoint);
+        _indexToWeight = std::vector<std::int32_t>(size, 0);
         for(const auto& interval : intervals)
         {
-            _leftEndpointToInterval[interval.Left].emplace(interval);
-            _rightEndpointToInterval[interval.Right].emplace(interval);
-            _indexToInterval[interval.Index] = interval;
+            _endpointToPartner[interval.Left] = interval.Right;
+            _endpointToPartner[interval.Right] = interval.Left;
+            _endpointToIndex[interval.Left] = interval.Index;
+            _endpointToIndex[interval.Right] = interval.Index;
+            _indexToLeft[interval.Index] = interval.Left;
+            _indexToWeight[interval.Index] = interval.Weight;
         }
 
-        _intervalsByIncreasingRightEndpoint = std::vector<Interval>(intervals.begin(), intervals.end());
-         std::sort(_intervalsByIncreasingRightEndpoint.begin(), _intervalsByIncreasingRightEndpoint.end(),
-          [](const Interval& a, const Interval& b) {
-              return a.Right < b.Right;
-          });  
-         _intervalsByIncreasingLeftEndpoint = std::vector<Interval>(intervals.begin(), intervals.end());
-         std::sort(_intervalsByIncreasingLeftEndpoint.begin(), _intervalsByIncreasingLeftEndpoint.end(),
-          [](const Interval& a, const Interval& b) {
-              return a.Left < b.Left;
-          });
-          _intervalsByDecreasingRightEndpoint = std::vector<Interval>(intervals.begin(), intervals.end());
-            std::sort(_intervalsByDecreasingRightEndpoint.begin(), _intervalsByDecreasingRightEndpoint.end(),
-          [](const Interval& a, const Interval& b) {
-              return a.Right > b.Right;
-          });  
+        _rightEndpointPredecessor = std::vector<std::int32_t>(end + 1, NoEndpoint);
+        _leftEndpointPredecessor = std::vector<std::int32_t>(end + 1, NoEndpoint);
+        for(auto e = 0; e < end; ++e)
+        {
+            _rightEndpointPredecessor[e + 1] = isRightEndpoint(e) ? e : _rightEndpointPredecessor[e];
+            _leftEndpointPredecessor[e + 1] = isLeftEndpoint(e) ? e : _leftEndpointPredecessor[e];
+        }
+
+        // Both orders fall straight out of a scan over the (dense) end-points, so no sort is needed.
+        _intervalsByIncreasingLeftEndpoint.reserve(size);
+        _intervalsByDecreasingRightEndpoint.reserve(size);
+        for(auto e = 0; e < end; ++e)
+        {
+            if(isLeftEndpoint(e))
+            {
+                _intervalsByIncreasingLeftEndpoint.push_back(makeInterval(e, _endpointToPartner[e], _endpointToIndex[e]));
+            }
+        }
+        for(auto e = end - 1; e >= 0; --e)
+        {
+            if(isRightEndpoint(e))
+            {
+                _intervalsByDecreasingRightEndpoint.push_back(makeInterval(_endpointToPartner[e], e, _endpointToIndex[e]));
+            }
+        }
+    }
+
+    [[nodiscard]] Interval DistinctIntervalModel::makeInterval(int left, int right, int intervalIndex) const
+    {
+        return Interval(left, right, intervalIndex, _indexToWeight[intervalIndex]);
     }
 
     [[nodiscard]] std::optional<Interval> DistinctIntervalModel::tryGetIntervalByRightEndpoint(int maybeRightEndpoint) const
     {
-        return _rightEndpointToInterval[maybeRightEndpoint];
+        const auto partner = _endpointToPartner[maybeRightEndpoint];
+        if(partner == NoEndpoint || partner > maybeRightEndpoint)
+        {
+            return std::nullopt;
+        }
+        return makeInterval(partner, maybeRightEndpoint, _endpointToIndex[maybeRightEndpoint]);
     }
 
     [[nodiscard]] std::optional<Interval> DistinctIntervalModel::tryGetIntervalByLeftEndpoint(int maybeLeftEndpoint) const
     {
-        return _leftEndpointToInterval[maybeLeftEndpoint];
+        const auto partner = _endpointToPartner[maybeLeftEndpoint];
+        if(partner < maybeLeftEndpoint) // Also covers NoEndpoint.
+        {
+            return std::nullopt;
+        }
+        return makeInterval(maybeLeftEndpoint, partner, _endpointToIndex[maybeLeftEndpoint]);
     }
 
     [[nodiscard]] Interval DistinctIntervalModel::getIntervalByRightEndpoint(int rightEndpoint) const
@@ -74,45 +102,28 @@ namespace cg::data_structures
 
     [[nodiscard]] Interval DistinctIntervalModel::getIntervalByIndex(int intervalIndex) const
     {
-        return _indexToInterval[intervalIndex];
+        const auto left = _indexToLeft[intervalIndex];
+        return makeInterval(left, _endpointToPartner[left], intervalIndex);
     }
 
     [[nodiscard]] std::optional<Interval> DistinctIntervalModel::tryGetRightEndpointPredecessorInterval(int rightEndpointUpperBoundExclusive) const
     {
-        auto it = std::lower_bound(
-        _intervalsByIncreasingRightEndpoint.begin(),
-        _intervalsByIncreasingRightEndpoint.end(),
-        rightEndpointUpperBoundExclusive,
-        [](const Interval& interval, int value) 
-        {
-            return interval.Right < value;
-        });
-
-        if (it == _intervalsByIncreasingRightEndpoint.begin())
+        const auto predecessor = _rightEndpointPredecessor[std::clamp(rightEndpointUpperBoundExclusive, 0, end)];
+        if (predecessor == NoEndpoint)
         {
             return std::nullopt;
         }
-        --it;
-        return *it;
+        return makeInterval(_endpointToPartner[predecessor], predecessor, _endpointToIndex[predecessor]);
     }
 
     [[nodiscard]] std::optional<Interval> DistinctIntervalModel::tryGetLeftEndpointPredecessorInterval(int leftEndpointUpperBoundExclusive) const
     {
-        auto it = std::lower_bound(
-        _intervalsByIncreasingLeftEndpoint.begin(),
-        _intervalsByIncreasingLeftEndpoint.end(),
-        leftEndpointUpperBoundExclusive,
-        [](const Interval& interval, int value) 
-        {
-            return interval.Left < value;
-        });
-
-        if (it == _intervalsByIncreasingLeftEndpoint.begin())
+        const auto predecessor = _leftEndpointPredecessor[std::clamp(leftEndpointUpperBoundExclusive, 0, end)];
+        if (predecessor == NoEndpoint)
         {
             return std::nullopt;
         }
-        --it;
-        return *it;
+        return makeInterval(predecessor, _endpointToPartner[predecessor], _endpointToIndex[predecessor]);
     }
 
     [[nodiscard]] std::vector<Interval> DistinctIntervalModel::getAllIntervals() const
@@ -30,4 +30,9 @@ namespace cg::data_structures
         }
         return _vertexToNeighbours[v];
     }
+
+    bool Graph::hasEdge(Vertex u, Vertex v) const
+    {
+        return neighbours(u).contains(v);
+    }
 }
@@ -4,45 +4,70 @@
 #include "data_structures/shared_interval_model.h"
 
 #include <algorithm>
-#include <ranges>
+#include <numeric>
+
+namespace
+{
+    // Stable counting sort of 'order' (positions into 'intervals') by key(interval) in [0, numKeys).
+    // On return offsets[k] is the start of the run with key k, and offsets[numKeys] == order.size().
+    template <typename TKey>
+    std::vector<int> countingSort(std::span<const cg::data_structures::Interval> intervals, std::span<const int> order, int numKeys, TKey key, std::vector<int> &offsets)
+    {
+        offsets.assign(numKeys + 1, 0);
+        for (auto position : order)
+        {
+            ++offsets[key(intervals[position]) + 1];
+        }
+        std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+        std::vector<int> sorted(order.size());
+        auto next = offsets;
+        for (auto position : order)
+        {
+            sorted[next[key(intervals[position])]++] = position;
+        }
+        return sorted;
+    }
+}
 
 namespace cg::data_structures
 {
     SharedIntervalModel::SharedIntervalModel(std::span<const Interval> intervals) : 
     size(intervals.size()),
-    end(cg::interval_model_utils::getMaxRightEndpoint(intervals) + 1)
+    end(intervals.empty() ? 0 : cg::interval_model_utils::getMaxRightEndpoint(intervals) + 1)
     {
         cg::interval_model_utils::verifyEndpointsInRange(intervals);
         cg::interval_model_utils::verifyIndicesDense(intervals);
 
-        _leftEndpointToIntervals = std::vector<std::vector<Interval>>(end);
-        _rightEndpointToIntervals = std::vector<std::vector<Interval>>(end);
-        for(const auto& interval : intervals)
-        {
-            _leftEndpointToIntervals[interval.Left].push_back(interval);
-            _rightEndpointToIntervals[interval.Right].push_back(interval);
-        }
-        for(auto i = 0; i < end; ++i)
+        // Two linear passes instead of a comparison sort per bucket: first order everything by decreasing length,
+        // then stably bucket by end-point, which leaves each bucket longest first.
+        std::vector<int> inputOrder(intervals.size());
+        std::iota(inputOrder.begin(), inputOrder.end(), 0);
+        std::vector<int> lengthOffsets;
+        const auto byDecreasingLength = countingSort(intervals, inputOrder, std::max(end, 1), [this](const Interval &i) { return end - 1 - i.length(); }, lengthOffsets);
+
+        const auto byLeft = countingSort(intervals, byDecreasingLength, end, [](const Interval &i) { return i.Left; }, _leftOffsets);
+        const auto byRight = countingSort(intervals, byDecreasingLength, end, [](const Interval &i) { return i.Right; }, _rightOffsets);
+
+        _leftIntervals.reserve(size);
+        _rightIntervals.reserve(size);
+        for (auto i = 0; i < size; ++i)
         {
-            auto& rightIntervals = _rightEndpointToIntervals[i];
-            std::ranges::sort(rightIntervals, [](const Interval &a, const Interval &b) {
-                return a.length() > b.length(); });
- 
-            auto& leftIntervals = _leftEndpointToIntervals[i];
-            std::ranges::sort(leftIntervals, [](const Interval &a, const Interval &b) {
-                return a.length() > b.length(); });
- 
+            _leftIntervals.push_back(intervals[byLeft[i]]);
+            _rightIntervals.push_back(intervals[byRight[i]]);
         }
     }
 
 
     [[nodiscard]] std::vector<Interval> SharedIntervalModel::getAllIntervalsWithLeftEndpoint(int leftEndpoint) const
     {
-        return _leftEndpointToIntervals[leftEndpoint];
+        const auto bucket = intervalsWithLeftEndpoint(leftEndpoint);
+        return std::vector<Interval>(bucket.begin(), bucket.end());
     }
 
     [[nodiscard]] std::vector<Interval> SharedIntervalModel::getAllIntervalsWithRightEndpoint(int rightEndpoint) const
     {
-        return _rightEndpointToIntervals[rightEndpoint];
+        const auto bucket = intervalsWithRightEndpoint(rightEndpoint);
+        return std::vector<Interval>(bucket.begin(), bucket.end());
     }
-}
\ No newline at end of file
+}
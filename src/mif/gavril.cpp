@@ -40,7 +40,7 @@ namespace
 
 namespace cg::mif
 {
-    void Gavril::computeRightForestBaseCase(const std::vector<cg::data_structures::Interval> &allIntervals, const std::vector<cg::data_structures::Interval> &firstLayerIntervals, array4<ForestScore> &rightForestScores, array3<DummyForestScore> &dummyRightForestScores, array4<ChildChoice> &rightChildChoices)
+    void Gavril::computeRightForestBaseCase(const std::vector<cg::data_structures::Interval> &firstLayerIntervals, sparse_array4<ForestScore> &rightForestScores, sparse_array3<DummyForestScore> &dummyRightForestScores, sparse_array4<ChildChoice> &rightChildChoices)
     {
         // Collect all end-points, in increasing order.
         std::vector<int> firstLayerEndpoints;
@@ -50,14 +50,6 @@ namespace cg::mif
             firstLayerEndpoints.push_back(interval.Right);
         }
         std::sort(firstLayerEndpoints.begin(), firstLayerEndpoints.end());
-        // Collect all intervals, ordered by decreasing right-endpoint.
-        std::vector<cg::data_structures::Interval> allIntervalsByDecreasingRight(allIntervals);
-        std::sort(allIntervalsByDecreasingRight.begin(), allIntervalsByDecreasingRight.end(),
-                  [](const cg::data_structures::Interval &a, const cg::data_structures::Interval &b)
-                  {
-                      return b.Right < a.Right;
-                  });
-
         std::vector<cg::data_structures::Interval> firstLayerIntervalsByDecreasingRight(firstLayerIntervals);
         std::sort(firstLayerIntervalsByDecreasingRight.begin(), firstLayerIntervalsByDecreasingRight.end(),
                   [](const cg::data_structures::Interval &a, const cg::data_structures::Interval &b)
@@ -95,11 +87,11 @@ namespace cg::mif
                         }
                     }
                 }
-                dummyRightForestScores(y, interval.Index, 0) =
+                dummyRightForestScores.set(y, interval.Index, 0,
                     DummyForestScore{
                         .score = maxDummyForestSize,
                         .split = split,
-                        .childIntervalIdx = bestChildIntervalIdx};
+                        .childIntervalIdx = bestChildIntervalIdx});
                 logStream() << std::format("DummyFR({},{},0)={}", y, interval.Index, maxDummyForestSize) << std::endl;
 
                 for (auto x : firstLayerEndpoints) // All end-points y such that: interval.Right <= y <= last endpoint at layer 0
@@ -169,14 +161,14 @@ namespace cg::mif
                         .xPrime = bestXPrime,
                         .childIntervalIdx = score.childIntervalIdx};
                     logStream() << std::format("FR({},{},{},0)={} with childType = {}", x, y, interval.Index, score.score, childType) << std::endl;
-                    rightForestScores(x, y, interval.Index, 0) = score;
-                    rightChildChoices(x, y, interval.Index, 0) = childChoice;
+                    rightForestScores.set(x, y, interval.Index, 0, score);
+                    rightChildChoices.set(x, y, interval.Index, 0, childChoice);
                 }
             }
         }
     }
 
-    void Gavril::computeRightForests(int layerIdx, const std::vector<cg::data_structures::Interval>& cumulativeIntervals, Forests& forests, array4<ChildChoice>& rightChildChoices)
+    void Gavril::computeRightForests(int layerIdx, const std::vector<cg::data_structures::Interval>& cumulativeIntervals, Forests& forests, sparse_array4<ChildChoice>& rightChildChoices)
     {
         if(layerIdx <= 0)
         {
@@ -238,7 +230,7 @@ namespace cg::mif
                     .split = bestSplit,
                     .childIntervalIdx = bestDummyIntervalIdx
                 };
-                forests.dummyRightForestScores(y, interval.Index, layerIdx) = dummyScore;
+                forests.dummyRightForestScores.set(y, interval.Index, layerIdx, dummyScore);
                 for (auto x : endpoints) // All end-points x such that: interval.Left < x <= interval.Right
                 {
                     if (x <= interval.Left)
@@ -319,7 +311,7 @@ namespace cg::mif
                             .score = 1 + maxRealChildForestSize,
                             .childIntervalIdx = bestChildIntervalIdx};
                     }
-                    forests.rightForestScores(x, y, interval.Index, layerIdx) = score;
+                    forests.rightForestScores.set(x, y, interval.Index, layerIdx, score);
                     logStream() << std::format("[computeRight] FR({},{},{},{})={} (bestDummy={},bestReal={},dummyChildIdx={},realChildIdx={},bestLeft={},bestRight={},bestInner={},bestQPrime={},bestXPrime={})",
                                              x, y, interval.Index, layerIdx, score.score, dummyScore.score, maxRealChildForestSize, dummyScore.childIntervalIdx,
                                              bestChildIntervalIdx, bestLeft, bestRight, bestInner, bestQPrime, bestXPrime)
@@ -329,7 +321,7 @@ namespace cg::mif
         }
     }
 
-    void Gavril::computeNewIntervalRightForests(int layerIdx, const std::vector<cg::data_structures::Interval> &newIntervalsAtThisLayer, const std::vector<cg::data_structures::Interval> &allIntervalsBeforeThisLayer, Forests &forests, array4<ChildChoice> &rightChildChoices)
+    void Gavril::computeNewIntervalRightForests(int layerIdx, const std::vector<cg::data_structures::Interval> &newIntervalsAtThisLayer, const std::vector<cg::data_structures::Interval> &allIntervalsBeforeThisLayer, Forests &forests, sparse_array4<ChildChoice> &rightChildChoices)
     {
         if (layerIdx <= 0)
         {
@@ -385,10 +377,10 @@ namespace cg::mif
                         }
                     }
                 }
-                forests.dummyRightForestScores(y, newInterval.Index, previousLayerIdx) = DummyForestScore{
+                forests.dummyRightForestScores.set(y, newInterval.Index, previousLayerIdx, DummyForestScore{
                     .score = maxDummyForestSize,
                     .split = bestSplit,
-                    .childIntervalIdx = bestChildIntervalIdx};
+                    .childIntervalIdx = bestChildIntervalIdx});
 
                 for (auto x : allEndpoints)
                 {
@@ -470,13 +462,13 @@ namespace cg::mif
                             .childIntervalIdx = bestRealChildIntervalIdx};
                     }
                     logStream() << std::format("[newIntervalRight] FR({},{},{},{})={}", x, y, newInterval.Index, previousLayerIdx, score.score) << std::endl;
-                    forests.rightForestScores(x, y, newInterval.Index, previousLayerIdx) = score;
+                    forests.rightForestScores.set(x, y, newInterval.Index, previousLayerIdx, score);
                 }
             }
         }
     }
 
-    void Gavril::computeRightChildChoices(const Forests &forests, const std::vector<cg::data_structures::Interval> allIntervals, const std::vector<cg::data_structures::Interval> &cumulativeIntervals, const std::vector<cg::data_structures::Interval> &cumulativeIntervalsOneBehind, array4<ChildChoice> &rightChildChoices, int layerIdx)
+    void Gavril::computeRightChildChoices(const Forests &forests, std::span<const cg::data_structures::Interval> allIntervals, const std::vector<cg::data_structures::Interval> &cumulativeIntervals, const std::vector<cg::data_structures::Interval> &cumulativeIntervalsOneBehind, sparse_array4<ChildChoice> &rightChildChoices, int layerIdx)
     {
         if(layerIdx <= 0)
         {
@@ -587,14 +579,14 @@ namespace cg::mif
                         throw std::runtime_error(std::format("Inconsistent right child choice: child type is {} and child interval index is {}", childType, bestChildIntervalIndex));
                     }
 
-                    rightChildChoices(x, y, interval.Index, layerIdx) = ChildChoice
+                    rightChildChoices.set(x, y, interval.Index, layerIdx, ChildChoice
                     {
                         .childType = childType,
                         .innerScore = bestChildScore,
                         .qPrime = bestInnerLeft,
                         .xPrime = bestInnerRight,
                         .childIntervalIdx = bestChildIntervalIndex,
-                    };
+                    });
                     logStream() << std::format("rightChildChoices({},{},{},{})=childType={},innerScore={},qPrime={},xPrime={},childIntervalIdx={}",
                         x, y, interval.Index, layerIdx,
                     childType,bestChildScore,bestInnerLeft,bestInnerRight,bestChildIntervalIndex) << std::endl;
@@ -604,7 +596,7 @@ namespace cg::mif
         }
     }
 
-    void Gavril::computeLeftForestBaseCase(const std::vector<cg::data_structures::Interval> &allIntervals, const std::vector<cg::data_structures::Interval>& firstLayerIntervals, array4<ForestScore>& leftForestScores, array4<ChildChoice>& leftChildChoices)
+    void Gavril::computeLeftForestBaseCase(const std::vector<cg::data_structures::Interval>& firstLayerIntervals, sparse_array4<ForestScore>& leftForestScores, sparse_array4<ChildChoice>& leftChildChoices)
     {
         // Collect all end-points, in increasing order.
         std::vector<int> firstLayerEndpoints;
@@ -614,12 +606,6 @@ namespace cg::mif
             firstLayerEndpoints.push_back(interval.Right);
         }
         std::sort(firstLayerEndpoints.begin(), firstLayerEndpoints.end());
-        // Collect all intervals, ordered by increasing right-endpoint.
-        std::vector<cg::data_structures::Interval> allIntervalsByIncreasingLeft(allIntervals);
-        std::sort(allIntervalsByIncreasingLeft.begin(), allIntervalsByIncreasingLeft.end(),
-          [](const cg::data_structures::Interval& a, const cg::data_structures::Interval& b) {
-              return a.Left < b.Left;
-          });
         std::vector<cg::data_structures::Interval> firstLayerIntervalsByIncreasingLeft(firstLayerIntervals);
         std::sort(firstLayerIntervalsByIncreasingLeft.begin(), firstLayerIntervalsByIncreasingLeft.end(),
           [](const cg::data_structures::Interval& a, const cg::data_structures::Interval& b) {
@@ -676,7 +662,7 @@ namespace cg::mif
                         .childIntervalIdx = bestRealChildIntervalIndex
                     };
 
-                    leftForestScores(z, q, interval.Index, 0) = score;
+                    leftForestScores.set(z, q, interval.Index, 0, score);
 
                     ChildChoice childChoice{
                         .childType = childType,
@@ -686,7 +672,7 @@ namespace cg::mif
                         .childIntervalIdx = bestRealChildIntervalIndex
                     };
 
-                    leftChildChoices(z, q, interval.Index, 0) = childChoice;
+                    leftChildChoices.set(z, q, interval.Index, 0, childChoice);
                     logStream() << std::format("FL({},{},{},0)={} with childType = {}", z, q, interval.Index, score.score, childType) << std::endl;
                 }
             }
@@ -696,7 +682,7 @@ namespace cg::mif
     void Gavril::computeLeftForests(int layerIdx,
                                     const std::vector<cg::data_structures::Interval> &allIntervals,
                                     Forests &forests,
-                                    array4<ChildChoice> &leftChildChoices)
+                                    sparse_array4<ChildChoice> &leftChildChoices)
     {
         if (layerIdx <= 0)
         {
@@ -764,7 +750,7 @@ namespace cg::mif
                     .score = maxDummyForestSize,
                     .split = bestDummySplit,
                     .childIntervalIdx = bestDummyIntervalIdx};
-                forests.dummyLeftForestScores(q, interval.Index, layerIdx - 1) = dummyScore;
+                forests.dummyLeftForestScores.set(q, interval.Index, layerIdx - 1, dummyScore);
                 logStream() << std::format("computeDummyLeft({},{},{})=(score={},childIdx={})",
                                          q, interval.Index, layerIdx - 1, maxDummyForestSize, bestDummyIntervalIdx)
                           << std::endl;
@@ -865,7 +851,7 @@ namespace cg::mif
                             .score = 1 + maxRealChildForestSize,
                             .childIntervalIdx = bestChildIntervalIdx};
                     }
-                    forests.leftForestScores(z, q, interval.Index, layerIdx) = score;
+                    forests.leftForestScores.set(z, q, interval.Index, layerIdx, score);
                     logStream() << std::format(
                                      "[computeLeft] FL({},{},{},{})={} (bestDummy={},bestReal={},dummyChildIdx={},realChildIdx={},bestLeft={},bestRight={},bestInner={},bestQPrime={},bestXPrime={})",
                                      z,
@@ -892,7 +878,7 @@ namespace cg::mif
                                                const std::vector<cg::data_structures::Interval> &newIntervalsAtThisLayer,
                                                const std::vector<cg::data_structures::Interval> &allIntervalsBeforeThisLayer,
                                                Forests &forests,
-                                               array4<ChildChoice> &leftChildChoices)
+                                               sparse_array4<ChildChoice> &leftChildChoices)
     {
         if (layerIdx <= 0)
         {
@@ -957,11 +943,11 @@ namespace cg::mif
                         }
                     }
                 }
-                forests.dummyLeftForestScores(q, newInterval.Index, previousLayerIdx) =
+                forests.dummyLeftForestScores.set(q, newInterval.Index, previousLayerIdx,
                 DummyForestScore{
                     .score = maxDummyForestSize,
                     .split = bestDummySplit,
-                    .childIntervalIdx = bestChildIntervalIdx};
+                    .childIntervalIdx = bestChildIntervalIdx});
                 logStream() << std::format("newIntervalDummyLeft({},{},{})=(score={},childIdx={})",
                                          q, newInterval.Index, previousLayerIdx, maxDummyForestSize, bestChildIntervalIdx)
                           << std::endl;
@@ -1057,7 +1043,7 @@ namespace cg::mif
                             .childIntervalIdx = bestRealChildIntervalIdx};
                     }
 
-                    forests.leftForestScores(z, q, newInterval.Index, previousLayerIdx) = score;
+                    forests.leftForestScores.set(z, q, newInterval.Index, previousLayerIdx, score);
                     logStream() << std::format("[newIntervalLeft] FL({},{},{},{})={}",
                                              z,
                                              q,
@@ -1072,10 +1058,10 @@ namespace cg::mif
 
 void Gavril::computeLeftChildChoices(
                                      const Forests& forests,
-                                     const std::vector<cg::data_structures::Interval> allIntervals,
+                                     std::span<const cg::data_structures::Interval> allIntervals,
                                      const std::vector<cg::data_structures::Interval>& cumulativeIntervals,
                                      const std::vector<cg::data_structures::Interval>& cumulativeIntervalsOneBehind,
-                                     array4<ChildChoice>& leftChildChoices,
+                                     sparse_array4<ChildChoice>& leftChildChoices,
                                      int layerIdx)
 {
     if (layerIdx <= 0)
@@ -1198,13 +1184,13 @@ void Gavril::computeLeftChildChoices(
                     throw std::runtime_error(std::format("Inconsistent left child choice: child type is {} and child interval index is {}", childType, bestChildIntervalIndex));
                 }
 
-                leftChildChoices(z, q, interval.Index, layerIdx) = ChildChoice{
+                leftChildChoices.set(z, q, interval.Index, layerIdx, ChildChoice{
                     .childType = childType,
                     .innerScore = bestChildScore,
                     .qPrime = bestInnerQ,    // q'
                     .xPrime = bestInnerX,    // x'
                     .childIntervalIdx = bestChildIntervalIndex
-                };
+                });
                 logStream() << std::format("leftChildChoices({},{},{},{})=childType={},innerScore={},qPrime={},xPrime={},childIntervalIdx={}",
                                          z,
                                          q,
@@ -1223,7 +1209,7 @@ void Gavril::computeLeftChildChoices(
 
     std::vector<int> Gavril::constructMif(const cg::data_structures::DistinctIntervalModel& intervalModel, int numLayers, const Forests& forests, const ChildChoices& childChoices)
     {
-        const auto &allIntervals = intervalModel.getAllIntervals();
+        const auto allIntervals = intervalModel.allIntervals();
 
         std::vector<int> endpoints;
         for (const auto &interval : allIntervals)
@@ -1457,9 +1443,43 @@ void Gavril::computeLeftChildChoices(
         return mifIntervalIdxs;
     }
 
+    Gavril::TableStats Gavril::tableStats(const Forests& forests, const ChildChoices& childChoices)
+    {
+        TableStats stats;
+        auto add = [&stats](const auto& table)
+        {
+            stats.storedEntries += table.size();
+            stats.memoryBytes += table.memoryBytes();
+            stats.denseBytes += table.denseBytes();
+        };
+        add(forests.leftForestScores);
+        add(forests.dummyLeftForestScores);
+        add(forests.rightForestScores);
+        add(forests.dummyRightForestScores);
+        add(childChoices.leftChildChoices);
+        add(childChoices.rightChildChoices);
+        return stats;
+    }
+
+    void Gavril::retireLayer(Forests& forests, ChildChoices& childChoices, int layerIdx)
+    {
+        forests.leftForestScores.clearLayer(layerIdx);
+        forests.dummyLeftForestScores.clearLayer(layerIdx);
+        forests.rightForestScores.clearLayer(layerIdx);
+        forests.dummyRightForestScores.clearLayer(layerIdx);
+        childChoices.leftChildChoices.freezeLayer(layerIdx);
+        childChoices.rightChildChoices.freezeLayer(layerIdx);
+    }
+
+    std::vector<cg::data_structures::Interval> Gavril::computeMif(std::span<const cg::data_structures::Interval> intervals, bool enableLogging)
+    {
+        TableStats tableStats;
+        return computeMif(intervals, tableStats, LayerRetention::AllLayers, enableLogging);
+    }
+
     // This is Gavril's algorithm for the maximum induced forest of a circle graph:
     // "Minimum weight feedback vertex sets in circle graphs", Information Processing Letters 107 (2008),pp1-6
-    std::vector<cg::data_structures::Interval> Gavril::computeMif(std::span<const cg::data_structures::Interval> intervals, bool enableLogging)
+    std::vector<cg::data_structures::Interval> Gavril::computeMif(std::span<const cg::data_structures::Interval> intervals, TableStats& tableStats, LayerRetention retention, bool enableLogging)
     {
         LoggingScope loggingScope(enableLogging);
         const cg::data_structures::DistinctIntervalModel intervalModel(intervals);
@@ -1481,23 +1501,33 @@ void Gavril::computeLeftChildChoices(
 
         Forests forests
         {
-            .leftForestScores = array4<ForestScore>(intervalModel.end, emptyScore), // 'FL_{w, i}[z, q]' in Gavril's notation.
-            .dummyLeftForestScores = array3<DummyForestScore>(intervalModel.end, emptyDummyScore), // 'FL_{w, i}(l_w, q]' in Gavril's notation.
-            .rightForestScores = array4<ForestScore>(intervalModel.end, emptyScore), // 'FR_{w, i}[x, y]' in Gavril's notation.
-            .dummyRightForestScores = array3<DummyForestScore>(intervalModel.end, emptyDummyScore), // 'FR_{w, i}(r_w, y]' in Gavril's notation.
+            .leftForestScores = sparse_array4<ForestScore>(intervalModel.end, emptyScore), // 'FL_{w, i}[z, q]' in Gavril's notation.
+            .dummyLeftForestScores = sparse_array3<DummyForestScore>(intervalModel.end, emptyDummyScore), // 'FL_{w, i}(l_w, q]' in Gavril's notation.
+            .rightForestScores = sparse_array4<ForestScore>(intervalModel.end, emptyScore), // 'FR_{w, i}[x, y]' in Gavril's notation.
+            .dummyRightForestScores = sparse_array3<DummyForestScore>(intervalModel.end, emptyDummyScore), // 'FR_{w, i}(r_w, y]' in Gavril's notation.
         };
         ChildChoices childChoices
         {
-            .leftChildChoices = array4<ChildChoice>(intervalModel.end, emptyChildChoice), // ul_{w, i}(x, y) in Gavril's notation
-            .rightChildChoices = array4<ChildChoice>(intervalModel.end, emptyChildChoice) // ur_{w, i}(x, y) in Gavril's notation
+            .leftChildChoices = sparse_array4<ChildChoice>(intervalModel.end, emptyChildChoice), // ul_{w, i}(x, y) in Gavril's notation
+            .rightChildChoices = sparse_array4<ChildChoice>(intervalModel.end, emptyChildChoice) // ur_{w, i}(x, y) in Gavril's notation
         };
         // The 'layers' are what Gavril calls A_0, ..., A_k at the start of page 5.
         auto intervalsAtLayer = cg::interval_model_utils::createLayers(intervalModel);
-         const auto& allIntervals = intervalModel.getAllIntervals();
+        const auto allIntervals = intervalModel.allIntervals();
 
         const auto& firstLayerIntervals = intervalsAtLayer[0];
-        computeRightForestBaseCase(allIntervals, firstLayerIntervals, forests.rightForestScores, forests.dummyRightForestScores, childChoices.rightChildChoices);
-        computeLeftForestBaseCase(allIntervals, firstLayerIntervals, forests.leftForestScores, childChoices.leftChildChoices);
+        computeRightForestBaseCase(firstLayerIntervals, forests.rightForestScores, forests.dummyRightForestScores, childChoices.rightChildChoices);
+        computeLeftForestBaseCase(firstLayerIntervals, forests.leftForestScores, childChoices.leftChildChoices);
+
+        tableStats = TableStats{};
+        auto recordPeak = [&]
+        {
+            const auto current = Gavril::tableStats(forests, childChoices);
+            tableStats.storedEntries = std::max(tableStats.storedEntries, current.storedEntries);
+            tableStats.memoryBytes = std::max(tableStats.memoryBytes, current.memoryBytes);
+            tableStats.denseBytes = std::max(tableStats.denseBytes, current.denseBytes);
+        };
+        recordPeak();
 
         std::vector<cg::data_structures::Interval> cumulativeIntervals; // This is V_i in Gavril's notation. At a given iteration, we set V_i = A_0 U ... A_i
         cumulativeIntervals.insert(cumulativeIntervals.begin(), firstLayerIntervals.begin(), firstLayerIntervals.end());
@@ -1530,7 +1560,16 @@ void Gavril::computeLeftChildChoices(
             computeLeftChildChoices(forests, allIntervals, cumulativeIntervals, cumulativeIntervalsOneBehind, childChoices.leftChildChoices, layerIdx);
             // Compute ur_{w, i}(x, y):
             computeRightChildChoices(forests, allIntervals, cumulativeIntervals, cumulativeIntervalsOneBehind, childChoices.rightChildChoices, layerIdx);
+
+            recordPeak();
+            // The next layer reads back to layerIdx - 1 at most.
+            if (retention == LayerRetention::RollingLayers && layerIdx >= 2)
+            {
+                retireLayer(forests, childChoices, layerIdx - 2);
+            }
         }
+        logStream() << std::format("DP tables at peak: {} entries, ~{} bytes (dense: {} bytes)", tableStats.storedEntries, tableStats.memoryBytes, tableStats.denseBytes) << std::endl;
+
         auto mifIntervalIdxs = constructMif(intervalModel, intervalsAtLayer.size(), forests, childChoices);
         std::vector<cg::data_structures::Interval> mifIntervals;
         for(auto idx : mifIntervalIdxs)
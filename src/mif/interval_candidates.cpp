@@ -0,0 +1,107 @@
+#include "mif/interval_candidates.h"
+
+#include <algorithm>
+#include <atomic>
+#include <numeric>
+
+namespace cg::mif
+{
+    namespace
+    {
+        std::atomic<bool> &pruningEnabled()
+        {
+            static std::atomic<bool> enabled(true);
+            return enabled;
+        }
+    }
+
+    bool candidatePruning()
+    {
+        return pruningEnabled().load(std::memory_order_relaxed);
+    }
+
+    void setCandidatePruning(bool enabled)
+    {
+        pruningEnabled().store(enabled, std::memory_order_relaxed);
+    }
+
+    IntervalCandidates::IntervalCandidates(std::span<const cg::data_structures::Interval> intervalsByLeft)
+        : _pruned(candidatePruning())
+    {
+        const int n = static_cast<int>(intervalsByLeft.size());
+        const int M = 2 * n;
+
+        _byLeft.assign(M, -1);
+        _byRight.assign(M, -1);
+        for (int v = 0; v < n; ++v)
+        {
+            _byLeft[intervalsByLeft[v].Left] = v;
+            _byRight[intervalsByLeft[v].Right] = v;
+        }
+
+        _firstWithLeftAtLeast.assign(M + 1, n);
+        for (int x = M - 1, v = n; x >= 0; --x)
+        {
+            if (_byLeft[x] != -1)
+            {
+                v = _byLeft[x];
+            }
+            _firstWithLeftAtLeast[x] = v;
+        }
+
+        if (!_pruned)
+        {
+            _allPositions.resize(n);
+            std::iota(_allPositions.begin(), _allPositions.end(), 0);
+            return;
+        }
+
+        // Positions are appended in increasing order, so each list comes out sorted.
+        _endingByOffsets.reserve(M + 1);
+        _crossingOffsets.reserve(M + 1);
+        for (int e = 0; e < M; ++e)
+        {
+            _endingByOffsets.push_back(static_cast<int>(_endingBy.size()));
+            _crossingOffsets.push_back(static_cast<int>(_crossing.size()));
+            for (int v = 0; v < n; ++v)
+            {
+                const auto &interval = intervalsByLeft[v];
+                if (interval.Right <= e)
+                {
+                    _endingBy.push_back(v);
+                }
+                if (interval.Left < e && e < interval.Right)
+                {
+                    _crossing.push_back(v);
+                }
+            }
+        }
+        _endingByOffsets.push_back(static_cast<int>(_endingBy.size()));
+        _crossingOffsets.push_back(static_cast<int>(_crossing.size()));
+    }
+
+    std::span<const int> IntervalCandidates::suffixFrom(std::span<const int> positions, int firstPosition)
+    {
+        return positions.subspan(std::lower_bound(positions.begin(), positions.end(), firstPosition) - positions.begin());
+    }
+
+    std::span<const int> IntervalCandidates::nestedIn(int a, int R) const
+    {
+        if (!_pruned)
+        {
+            return _allPositions;
+        }
+        const std::span<const int> endingBy(_endingBy.data() + _endingByOffsets[R], _endingBy.data() + _endingByOffsets[R + 1]);
+        return suffixFrom(endingBy, _firstWithLeftAtLeast[a + 1]);
+    }
+
+    std::span<const int> IntervalCandidates::crossing(int e, int minLeft) const
+    {
+        if (!_pruned)
+        {
+            return _allPositions;
+        }
+        const std::span<const int> crossingE(_crossing.data() + _crossingOffsets[e], _crossing.data() + _crossingOffsets[e + 1]);
+        return suffixFrom(crossingE, _firstWithLeftAtLeast[minLeft]);
+    }
+}
@@ -2,10 +2,15 @@
 
 #include "data_structures/distinct_interval_model.h"
 #include "data_structures/interval.h"
+#include "mif/forest_tables.h"
+#include "mif/interval_candidates.h"
 #include "utils/array_utils.h"
+#include "utils/max_plus.h"
+#include "utils/thread_pool.h"
 
 #include <algorithm>
 #include <functional>
+#include <span>
 #include <limits>
 #include <utility>
 #include <vector>
@@ -28,6 +33,11 @@ namespace
     };
 
     constexpr int INF_NEG = std::numeric_limits<int>::min() / 4;
+
+    // Smallest chunk handed to a pool thread: a chunk of intervals v costs O(n) per interval, a chunk of Lp cells
+    // O(n^2) per cell, and anything finer is dominated by the hand-off.
+    constexpr int minIntervalsPerChunk = 8;
+    constexpr int minCellsPerChunk = 2;
 }
 
 namespace cg::mif
@@ -40,9 +50,11 @@ namespace cg::mif
             std::vector<cg::data_structures::Interval> picked;
         };
 
-        ComputationResult computeMifInternal(const cg::data_structures::DistinctIntervalModel &intervalModel, bool needSolution)
+        // Scores are at most n and are kept in TScore cells; all arithmetic on them is done in int.
+        template <typename TScore>
+        ComputationResult computeMifInternal(const cg::data_structures::DistinctIntervalModel &intervalModel, bool needSolution, int threadCount)
         {
-            const std::vector<cg::data_structures::Interval> intervals = intervalModel.getAllIntervals();
+            const std::span<const cg::data_structures::Interval> intervals = intervalModel.allIntervals();
             const int n = static_cast<int>(intervals.size());
             if (n == 0)
             {
@@ -51,9 +63,12 @@ namespace cg::mif
 
             const int M = 2 * n;
 
-            cg::utils::array3<int> rightForest(n, M, M, 0);
-            cg::utils::array3<int> leftForest(n, M, M, 0);
-            cg::utils::array2<int> B(M + 1, M, 0);
+            // The B-cell rows rightForest(v, s + 1, R) and the q loops' rightForest(v, q, R) walk the middle coordinate,
+            // which RightForestTable stores contiguously. The q loops' inner terms walk the last coordinate: contiguous
+            // in the row-major leftForest, strided in rightForest.
+            RightForestTable<TScore> rightForest(n, M, M, 0);
+            cg::utils::array3<TScore> leftForest(n, M, M, 0);
+            cg::utils::array2<TScore> B(M + 1, M, 0);
 
             cg::utils::array2<BChoice> bChoices;
             cg::utils::array3<SideChoice> rfChoices;
@@ -79,189 +94,114 @@ namespace cg::mif
                 {
                     return;
                 }
-                B(a + 1, R) = value;
+                B(a + 1, R) = static_cast<TScore>(value);
                 if (needSolution)
                 {
                     bChoices(a + 1, R) = choice;
                 }
             };
 
-            std::vector<int> intervalByRight(M, -1);
-            std::vector<int> intervalByLeft(M, -1);
-            for (int w = 0; w < n; ++w)
-            {
-                const auto &interval = intervals[w];
-                intervalByRight[interval.Right] = w;
-                intervalByLeft[interval.Left] = w;
-            }
+            const IntervalCandidates candidates(intervals);
 
+            // For a fixed R each step L needs the B cell and forest cells of the steps before it, so the steps stay
+            // serial. Within a step, the B max over (v, s) is a reduction over v, the MR/ML tables are independent
+            // per v, and the forest cells are independent per Lp; those run on the pool. Reductions merge chunk
+            // winners in index order, so scores and choices match the serial scan for every thread count.
+            cg::utils::ThreadPool pool(threadCount);
+            const int intervalChunk = pool.chunkSizeFor(n, minIntervalsPerChunk);
+
+            // Folds the best split s in [lv, rv) of the B-cell candidate v, for the cell (a, R), into (best,
+            // bestChoice); v is skipped unless a < lv and rv <= R. s == lv has an empty left part. For s > lv,
+            // getB(lv, s) = B(lv + 1, s) and rightForest(v, s + 1, R) are both contiguous in s, so the rest of the
+            // range is one max-plus reduction.
+            const auto bestSplitOf = [&](int v, int a, int R, int &best, BChoice &bestChoice)
+            {
+                const int lv = intervals[v].Left;
+                const int rv = intervals[v].Right;
+                if (!(a < lv && rv <= R))
+                {
+                    return;
+                }
+                const int first = 1 + rightForest(v, lv + 1, R);
+                if (first > best)
+                {
+                    best = first;
+                    if (needSolution)
+                    {
+                        bestChoice = BChoice{true, v, lv};
+                    }
+                }
+                if (rv - lv > 1)
+                {
+                    const auto *leftRow = &B(lv + 1, lv + 1);
+                    const auto *rightRow = &rightForest(v, lv + 2, R);
+                    if (needSolution)
+                    {
+                        const auto [sum, offset] = cg::utils::argMaxPlus(leftRow, rightRow, rv - lv - 1);
+                        if (1 + sum > best)
+                        {
+                            best = 1 + sum;
+                            bestChoice = BChoice{true, v, lv + 1 + offset};
+                        }
+                    }
+                    else
+                    {
+                        best = std::max(best, 1 + cg::utils::maxPlus(leftRow, rightRow, rv - lv - 1));
+                    }
+                }
+            };
             for (int R = 0; R < M; ++R)
             {
                 for (int L = R; L >= 0; --L)
                 {
                     if (L <= R - 1)
                     {
-                        int best = 0;
-                        BChoice bestChoice;
-                        for (int v = 0; v < n; ++v)
+                        const auto nested = candidates.nestedIn(L, R);
+                        const auto [best, bestChoice] = pool.argMax(static_cast<int>(nested.size()), intervalChunk, 0, BChoice{}, [&](int begin, int end, int best, BChoice bestChoice) -> std::pair<int, BChoice>
                         {
-                            const auto &interval = intervals[v];
-                            const int lv = interval.Left;
-                            const int rv = interval.Right;
-                            if (!(L < lv && rv <= R))
+                            for (int k = begin; k < end; ++k)
                             {
-                                continue;
-                            }
-                            for (int s = lv; s < rv; ++s)
-                            {
-                                const int left = getB(lv, s);
-                                const int right = rightForest(v, s + 1, R);
-                                const int candidate = 1 + left + right;
-                                if (candidate > best)
-                                {
-                                    best = candidate;
-                                    if (needSolution)
-                                    {
-                                        bestChoice = BChoice{true, v, s};
-                                    }
-                                }
+                                bestSplitOf(nested[k], L, R, best, bestChoice);
                             }
-                        }
+                            return {best, bestChoice};
+                        });
                         setB(L, R, best, bestChoice);
                     }
 
-                    const int wRight = intervalByRight[L];
+                    const int wRight = candidates.byRight(L);
                     if (wRight != -1)
                     {
                         const auto &wInterval = intervals[wRight];
                         const int lw = wInterval.Left;
                         const int rw = wInterval.Right;
-                        std::vector<std::vector<int>> MR_vp(n, std::vector<int>(M, INF_NEG));
-                        std::vector<std::vector<int>> MR_arg_q(n, std::vector<int>(M, -1));
-                        for (int v = 0; v < n; ++v)
-                        {
-                            if (v == wRight)
-                            {
-                                continue;
-                            }
-                            const auto &child = intervals[v];
-                            const int lv = child.Left;
-                            const int rv = child.Right;
-                            if (!(rw + 1 <= rv && rv <= R && lv <= rw - 1))
-                            {
-                                continue;
-                            }
-                            const int pStart = std::max(lv, lw + 1);
-                            for (int p = pStart; p < rw; ++p)
-                            {
-                                int best_q = INF_NEG;
-                                int best_q_arg = -1;
-                                for (int q = rw + 1; q <= rv; ++q)
-                                {
-                                    int inner = 0;
-                                    if (p + 1 <= q - 1)
-                                    {
-                                        inner = rightForest(wRight, p + 1, q - 1);
-                                    }
-                                    const int val = rightForest(v, q, R);
-                                    const int cand_q = val + inner;
-                                    if (cand_q > best_q)
-                                    {
-                                        best_q = cand_q;
-                                        best_q_arg = q;
-                                    }
-                                }
-                                MR_vp[v][p] = best_q;
-                                MR_arg_q[v][p] = best_q_arg;
-                            }
-                        }
-
-                        const int base = getB(rw, R);
-                        for (int Lp = rw; Lp > lw; --Lp)
+                        // Children v with lv < rw < rv; the MR rows are indexed by position k in this list.
+                        const auto crossers = candidates.crossing(rw);
+                        const int numCrossers = static_cast<int>(crossers.size());
+                        std::vector<std::vector<int>> MR_vp(numCrossers, std::vector<int>(M, INF_NEG));
+                        std::vector<std::vector<int>> MR_arg_q(numCrossers, std::vector<int>(M, -1));
+                        pool.parallelFor(numCrossers, intervalChunk, [&](int begin, int end)
                         {
-                            int best = base;
-                            SideChoice bestChoice;
-                            if (needSolution)
-                            {
-                                bestChoice.type = 1;
-                            }
-                            for (int v = 0; v < n; ++v)
+                            for (int k = begin; k < end; ++k)
                             {
-                                if (v == wRight)
-                                {
-                                    continue;
-                                }
+                                const int v = crossers[k];
                                 const auto &child = intervals[v];
                                 const int lv = child.Left;
                                 const int rv = child.Right;
-                                if (!(Lp <= lv && lv <= rw - 1 && rw + 1 <= rv && rv <= R))
+                                if (!(lv < rw && rw < rv && rv <= R))
                                 {
                                     continue;
                                 }
                                 const int pStart = std::max(lv, lw + 1);
                                 for (int p = pStart; p < rw; ++p)
-                                {
-                                    const int mr = MR_vp[v][p];
-                                    if (mr == INF_NEG)
-                                    {
-                                        continue;
-                                    }
-                                    const int left = leftForest(v, Lp, p);
-                                    const int candidate = 1 + left + mr;
-                                    if (candidate > best)
-                                    {
-                                        best = candidate;
-                                        if (needSolution)
-                                        {
-                                            bestChoice.type = 2;
-                                            bestChoice.child = v;
-                                            bestChoice.p = p;
-                                            bestChoice.q = MR_arg_q[v][p];
-                                        }
-                                    }
-                                }
-                            }
-                            rightForest(wRight, Lp, R) = best;
-                            if (needSolution)
-                            {
-                                rfChoices(wRight, Lp, R) = bestChoice;
-                            }
-                        }
-                    }
-
-                    const int wLeft = intervalByLeft[L];
-                    if (wLeft != -1)
-                    {
-                        const auto &wInterval = intervals[wLeft];
-                        const int lw = wInterval.Left;
-                        const int rw = wInterval.Right;
-                        if (rw > R)
-                        {
-                            std::vector<std::vector<int>> ML_vp(n, std::vector<int>(M, INF_NEG));
-                            std::vector<std::vector<int>> ML_arg_q(n, std::vector<int>(M, -1));
-                            for (int v = 0; v < n; ++v)
-                            {
-                                if (v == wLeft)
-                                {
-                                    continue;
-                                }
-                                const auto &child = intervals[v];
-                                const int lv = child.Left;
-                                const int rv = child.Right;
-                                if (!(lv <= lw - 1 && lw + 1 <= rv && rv <= R))
-                                {
-                                    continue;
-                                }
-                                for (int p = lv; p < lw; ++p)
                                 {
                                     int best_q = INF_NEG;
                                     int best_q_arg = -1;
-                                    for (int q = lw + 1; q <= rv; ++q)
+                                    for (int q = rw + 1; q <= rv; ++q)
                                     {
                                         int inner = 0;
                                         if (p + 1 <= q - 1)
                                         {
-                                            inner = leftForest(wLeft, p + 1, q - 1);
+                                            inner = rightForest(wRight, p + 1, q - 1);
                                         }
                                         const int val = rightForest(v, q, R);
                                         const int cand_q = val + inner;
@@ -271,13 +211,17 @@ namespace cg::mif
                                             best_q_arg = q;
                                         }
                                     }
-                                    ML_vp[v][p] = best_q;
-                                    ML_arg_q[v][p] = best_q_arg;
+                                    MR_vp[k][p] = best_q;
+                                    MR_arg_q[k][p] = best_q_arg;
                                 }
                             }
+                        });
 
-                            const int base = getB(lw, R);
-                            for (int Lp = lw; Lp >= 0; --Lp)
+                        const int base = getB(rw, R);
+                        const int rightCells = rw - lw;
+                        pool.parallelFor(rightCells, pool.chunkSizeFor(rightCells, minCellsPerChunk), [&](int begin, int end)
+                        {
+                            for (int Lp = rw - begin; Lp > rw - end; --Lp)
                             {
                                 int best = base;
                                 SideChoice bestChoice;
@@ -285,28 +229,27 @@ namespace cg::mif
                                 {
                                     bestChoice.type = 1;
                                 }
-                                for (int v = 0; v < n; ++v)
+                                // The crossers with lv >= Lp are a suffix of the list.
+                                for (int k = numCrossers - static_cast<int>(candidates.crossing(rw, Lp).size()); k < numCrossers; ++k)
                                 {
-                                    if (v == wLeft)
-                                    {
-                                        continue;
-                                    }
+                                    const int v = crossers[k];
                                     const auto &child = intervals[v];
                                     const int lv = child.Left;
                                     const int rv = child.Right;
-                                    if (!(Lp <= lv && lv <= lw - 1 && lw + 1 <= rv && rv <= R))
+                                    if (!(Lp <= lv && lv < rw && rw < rv && rv <= R))
                                     {
                                         continue;
                                     }
-                                    for (int p = lv; p < lw; ++p)
+                                    const int pStart = std::max(lv, lw + 1);
+                                    for (int p = pStart; p < rw; ++p)
                                     {
-                                        const int ml = ML_vp[v][p];
-                                        if (ml == INF_NEG)
+                                        const int mr = MR_vp[k][p];
+                                        if (mr == INF_NEG)
                                         {
                                             continue;
                                         }
                                         const int left = leftForest(v, Lp, p);
-                                        const int candidate = 1 + left + ml;
+                                        const int candidate = 1 + left + mr;
                                         if (candidate > best)
                                         {
                                             best = candidate;
@@ -315,47 +258,135 @@ namespace cg::mif
                                                 bestChoice.type = 2;
                                                 bestChoice.child = v;
                                                 bestChoice.p = p;
-                                                bestChoice.q = ML_arg_q[v][p];
+                                                bestChoice.q = MR_arg_q[k][p];
                                             }
                                         }
                                     }
                                 }
-                                leftForest(wLeft, Lp, R) = best;
+                                rightForest(wRight, Lp, R) = static_cast<TScore>(best);
                                 if (needSolution)
                                 {
-                                    lfChoices(wLeft, Lp, R) = bestChoice;
+                                    rfChoices(wRight, Lp, R) = bestChoice;
                                 }
                             }
-                        }
+                        });
                     }
-                }
 
-                int best = 0;
-                BChoice bestChoice;
-                for (int v = 0; v < n; ++v)
-                {
-                    const auto &interval = intervals[v];
-                    const int lv = interval.Left;
-                    const int rv = interval.Right;
-                    if (rv > R)
-                    {
-                        continue;
-                    }
-                    for (int s = lv; s < rv; ++s)
+                    const int wLeft = candidates.byLeft(L);
+                    if (wLeft != -1)
                     {
-                        const int left = getB(lv, s);
-                        const int right = rightForest(v, s + 1, R);
-                        const int candidate = 1 + left + right;
-                        if (candidate > best)
+                        const auto &wInterval = intervals[wLeft];
+                        const int lw = wInterval.Left;
+                        const int rw = wInterval.Right;
+                        if (rw > R)
                         {
-                            best = candidate;
-                            if (needSolution)
+                            // Children v with lv < lw < rv; the ML rows are indexed by position k in this list.
+                            const auto crossers = candidates.crossing(lw);
+                            const int numCrossers = static_cast<int>(crossers.size());
+                            std::vector<std::vector<int>> ML_vp(numCrossers, std::vector<int>(M, INF_NEG));
+                            std::vector<std::vector<int>> ML_arg_q(numCrossers, std::vector<int>(M, -1));
+                            pool.parallelFor(numCrossers, intervalChunk, [&](int begin, int end)
                             {
-                                bestChoice = BChoice{true, v, s};
-                            }
+                                for (int k = begin; k < end; ++k)
+                                {
+                                    const int v = crossers[k];
+                                    const auto &child = intervals[v];
+                                    const int lv = child.Left;
+                                    const int rv = child.Right;
+                                    if (!(lv < lw && lw < rv && rv <= R))
+                                    {
+                                        continue;
+                                    }
+                                    for (int p = lv; p < lw; ++p)
+                                    {
+                                        int best_q = INF_NEG;
+                                        int best_q_arg = -1;
+                                        for (int q = lw + 1; q <= rv; ++q)
+                                        {
+                                            int inner = 0;
+                                            if (p + 1 <= q - 1)
+                                            {
+                                                inner = leftForest(wLeft, p + 1, q - 1);
+                                            }
+                                            const int val = rightForest(v, q, R);
+                                            const int cand_q = val + inner;
+                                            if (cand_q > best_q)
+                                            {
+                                                best_q = cand_q;
+                                                best_q_arg = q;
+                                            }
+                                        }
+                                        ML_vp[k][p] = best_q;
+                                        ML_arg_q[k][p] = best_q_arg;
+                                    }
+                                }
+                            });
+
+                            const int base = getB(lw, R);
+                            const int leftCells = lw + 1;
+                            pool.parallelFor(leftCells, pool.chunkSizeFor(leftCells, minCellsPerChunk), [&](int begin, int end)
+                            {
+                                for (int Lp = lw - begin; Lp > lw - end; --Lp)
+                                {
+                                    int best = base;
+                                    SideChoice bestChoice;
+                                    if (needSolution)
+                                    {
+                                        bestChoice.type = 1;
+                                    }
+                                    // The crossers with lv >= Lp are a suffix of the list.
+                                    for (int k = numCrossers - static_cast<int>(candidates.crossing(lw, Lp).size()); k < numCrossers; ++k)
+                                    {
+                                        const int v = crossers[k];
+                                        const auto &child = intervals[v];
+                                        const int lv = child.Left;
+                                        const int rv = child.Right;
+                                        if (!(Lp <= lv && lv < lw && lw < rv && rv <= R))
+                                        {
+                                            continue;
+                                        }
+                                        for (int p = lv; p < lw; ++p)
+                                        {
+                                            const int ml = ML_vp[k][p];
+                                            if (ml == INF_NEG)
+                                            {
+                                                continue;
+                                            }
+                                            const int left = leftForest(v, Lp, p);
+                                            const int candidate = 1 + left + ml;
+                                            if (candidate > best)
+                                            {
+                                                best = candidate;
+                                                if (needSolution)
+                                                {
+                                                    bestChoice.type = 2;
+                                                    bestChoice.child = v;
+                                                    bestChoice.p = p;
+                                                    bestChoice.q = ML_arg_q[k][p];
+                                                }
+                                            }
+                                        }
+                                    }
+                                    leftForest(wLeft, Lp, R) = static_cast<TScore>(best);
+                                    if (needSolution)
+                                    {
+                                        lfChoices(wLeft, Lp, R) = bestChoice;
+                                    }
+                                }
+                            });
                         }
                     }
                 }
+
+                const auto nested = candidates.nestedIn(-1, R);
+                const auto [best, bestChoice] = pool.argMax(static_cast<int>(nested.size()), intervalChunk, 0, BChoice{}, [&](int begin, int end, int best, BChoice bestChoice) -> std::pair<int, BChoice>
+                {
+                    for (int k = begin; k < end; ++k)
+                    {
+                        bestSplitOf(nested[k], -1, R, best, bestChoice);
+                    }
+                    return {best, bestChoice};
+                });
                 setB(-1, R, best, bestChoice);
             }
 
@@ -491,17 +522,25 @@ namespace cg::mif
                          picked.end());
             return ComputationResult{answer, picked};
         }
+
+        ComputationResult computeMifWithNarrowestScores(const cg::data_structures::DistinctIntervalModel &intervalModel, bool needSolution, int threadCount)
+        {
+            return cg::utils::withNarrowestCell(intervalModel.allIntervals().size(), [&]<typename TScore>(TScore)
+            {
+                return computeMifInternal<TScore>(intervalModel, needSolution, threadCount);
+            });
+        }
     }
 
-    int MifRscanN5Qspace::computeMifSize(const cg::data_structures::DistinctIntervalModel &intervalModel)
+    int MifRscanN5Qspace::computeMifSize(const cg::data_structures::DistinctIntervalModel &intervalModel, int threadCount)
     {
-        return computeMifInternal(intervalModel, false).size;
+        return computeMifWithNarrowestScores(intervalModel, false, threadCount).size;
     }
 
     std::pair<int, std::vector<cg::data_structures::Interval>>
-    MifRscanN5Qspace::computeMif(const cg::data_structures::DistinctIntervalModel &intervalModel)
+    MifRscanN5Qspace::computeMif(const cg::data_structures::DistinctIntervalModel &intervalModel, int threadCount)
     {
-        const auto result = computeMifInternal(intervalModel, true);
+        const auto result = computeMifWithNarrowestScores(intervalModel, true, threadCount);
         return {result.size, result.picked};
     }
 }
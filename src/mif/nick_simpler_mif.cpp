@@ -1,11 +1,17 @@
 #include "mif/nick_simpler_mif.h"
+#include "mif/forest_tables.h"
+#include "mif/interval_candidates.h"
 
 #include "data_structures/interval.h"
 #include "data_structures/distinct_interval_model.h"
 #include "utils/array_utils.h"
+#include "utils/max_plus.h"
+#include "utils/thread_pool.h"
 
 #include <algorithm>
+#include <cstddef>
 #include <functional>
+#include <span>
 #include <utility>
 #include <vector>
 
@@ -26,6 +32,14 @@ namespace
         int q = -1;
     };
 
+    // Best q for each split p of an attach-child transition with fixed root w, right end R and child v: row k holds,
+    // for p in [lv, e) at index p - lv, the largest rightForest(v, q, R) + middle(w, p + 1, q - 1) and its first
+    // maximising q. Rows are indexed by the child's position k in the root's candidate list.
+    struct SplitRows
+    {
+        std::vector<std::vector<int>> score;
+        std::vector<std::vector<int>> q;
+    };
 }
 
 namespace cg::mif
@@ -38,9 +52,11 @@ namespace cg::mif
             std::vector<cg::data_structures::Interval> picked;
         };
 
-        ComputationResult computeMifInternal(const cg::data_structures::DistinctIntervalModel &intervalModel, bool needSolution)
+        // Scores are at most n and are kept in TScore cells; all arithmetic on them is done in int.
+        template <typename TScore>
+        ComputationResult computeMifInternal(const cg::data_structures::DistinctIntervalModel &intervalModel, bool needSolution, int threadCount)
         {
-            const std::vector<cg::data_structures::Interval> intervals = intervalModel.getAllIntervals();
+            const std::span<const cg::data_structures::Interval> intervals = intervalModel.allIntervals();
             const int n = static_cast<int>(intervals.size());
             if (n == 0)
             {
@@ -49,10 +65,13 @@ namespace cg::mif
 
             const int M = 2 * n;
 
-            cg::utils::array3<int> rightForest(n, M, M, 0);
-            cg::utils::array3<int> leftForest(n, M, M, 0);
+            // computeBCell's row rightForest(v, s + 1, R) and fillSplitRow's rightForest(v, q, R) walk the middle
+            // coordinate, which RightForestTable stores contiguously. fillSplitRow's middle(w, p + 1, q - 1) walks the
+            // last coordinate: contiguous when middle is the row-major leftForest, strided when it is rightForest.
+            RightForestTable<TScore> rightForest(n, M, M, 0);
+            cg::utils::array3<TScore> leftForest(n, M, M, 0);
 
-            cg::utils::array2<int> B(M + 1, M, 0);
+            cg::utils::array2<TScore> B(M + 1, M, 0);
 
             cg::utils::array2<BChoice> bChoices;
             cg::utils::array3<SideChoice> rfChoices;
@@ -74,192 +93,259 @@ namespace cg::mif
             };
             const auto setB = [&](int a, int R, int value, const BChoice &choice)
             {
-                B(a + 1, R) = value;
+                B(a + 1, R) = static_cast<TScore>(value);
                 if (needSolution)
                 {
                     bChoices(a + 1, R) = choice;
                 }
             };
 
-            for (int width = 0; width <= M; ++width)
+            const IntervalCandidates candidates(intervals);
+
+            // In the attach-child transition only leftForest(v, L, p) depends on L, so the max over q for each
+            // (w, R, v, p) is computed once, by the cell with L == lv that first admits v, and reused by the cells
+            // with smaller L. Per (w, v, L, R) that leaves a single pass over p. The cells sharing (w, R) have
+            // different widths, so each cache entry is only touched by one thread at a time.
+            std::vector<SplitRows> rightSplits(static_cast<std::size_t>(n) * M);
+            std::vector<SplitRows> leftSplits(static_cast<std::size_t>(n) * M);
+            const auto fillSplitRow = [&](SplitRows &splits, int k, const auto &middle, int w, int v, int e, int R)
             {
-                for (int a = -1; a < M - 1; ++a)
+                const int lv = intervals[v].Left;
+                const int rv = intervals[v].Right;
+                auto &scores = splits.score[k];
+                scores.assign(e - lv, 0);
+                if (needSolution)
+                {
+                    splits.q[k].assign(e - lv, -1);
+                }
+                for (int p = lv; p < e; ++p)
                 {
-                    const int R = a + width;
-                    if (R < 0 || R >= M)
+                    int bestScore = 0;
+                    int bestQ = -1;
+                    for (int q = e + 1; q <= rv; ++q)
+                    {
+                        int middleScore = 0;
+                        if (p + 1 <= q - 1)
+                        {
+                            middleScore = middle(w, p + 1, q - 1);
+                        }
+                        const int score = rightForest(v, q, R) + middleScore;
+                        if (bestQ == -1 || score > bestScore)
+                        {
+                            bestScore = score;
+                            bestQ = q;
+                        }
+                    }
+                    scores[p - lv] = bestScore;
+                    if (needSolution)
+                    {
+                        splits.q[k][p - lv] = bestQ;
+                    }
+                }
+            };
+
+            // Every cell of a given width only reads cells of smaller widths, except that forest cells with
+            // rw == L (or lw == L) read the B cell of the same width. So each width is two parallel passes: the B
+            // cells, then the rightForest/leftForest cells. Each cell is computed by exactly one thread with the same
+            // loop order as the sequential code, so the results do not depend on the thread count.
+            const auto computeBCell = [&](int a, int R)
+            {
+                int best = 0;
+                BChoice bestChoice;
+                for (const int v : candidates.nestedIn(a, R))
+                {
+                    const auto &interval = intervals[v];
+                    const int lv = interval.Left;
+                    const int rv = interval.Right;
+                    if (!(a < lv && rv <= R))
                     {
                         continue;
                     }
-                    int best = 0;
-                    BChoice bestChoice;
-                    for (int v = 0; v < n; ++v)
+                    // The max over s of leftForest(v, a + 1, s) + rightForest(v, s + 1, R), s in [lv, rv). Since
+                    // a < lv, every left cell is a real one, and both rows are contiguous in s: the last coordinate
+                    // of leftForest, and the middle one of rightForest, which RightForestTable stores innermost.
+                    const auto *leftRow = &leftForest(v, a + 1, lv);
+                    const auto *rightRow = &rightForest(v, lv + 1, R);
+                    if (needSolution)
                     {
-                        const auto &interval = intervals[v];
-                        const int lv = interval.Left;
-                        const int rv = interval.Right;
-                        if (!(a < lv && rv <= R))
+                        const auto [sum, offset] = cg::utils::argMaxPlus(leftRow, rightRow, rv - lv);
+                        if (1 + sum > best)
                         {
-                            continue;
-                        }
-                        for (int s = lv; s < rv; ++s)
-                        {
-                            const int leftStart = a + 1;
-                            int leftScore = 0;
-                            if (leftStart >= 0 && leftStart <= s)
-                            {
-                                leftScore = leftForest(v, leftStart, s);
-                            }
-                            const int candidate = 1 + leftScore + rightForest(v, s + 1, R);
-                            if (candidate > best)
-                            {
-                                best = candidate;
-                                if (needSolution)
-                                {
-                                    bestChoice = BChoice{true, v, s};
-                                }
-                            }
+                            best = 1 + sum;
+                            bestChoice = BChoice{true, v, lv + offset};
                         }
                     }
-                    setB(a, R, best, bestChoice);
+                    else
+                    {
+                        best = std::max(best, 1 + cg::utils::maxPlus(leftRow, rightRow, rv - lv));
+                    }
                 }
+                setB(a, R, best, bestChoice);
+            };
 
-                for (int L = 0; L < M; ++L)
+            const auto computeForestCells = [&](int L, int R)
+            {
+                for (int w = 0; w < n; ++w)
                 {
-                    const int R = L + width;
-                    if (R >= M)
+                    const auto &wInterval = intervals[w];
+                    const int lw = wInterval.Left;
+                    const int rw = wInterval.Right;
+                    if (!(lw < L && L <= rw && rw <= R))
+                    {
+                        continue;
+                    }
+                    int best = getB(rw, R);
+                    SideChoice bestChoice;
+                    if (needSolution)
+                    {
+                        bestChoice.type = 1;
+                    }
+                    // Children v with L <= lv < rw < rv <= R: the ones with lv >= L are a suffix of the list.
+                    const auto children = candidates.crossing(rw, lw + 1);
+                    const int numChildren = static_cast<int>(children.size());
+                    auto &splits = rightSplits[static_cast<std::size_t>(w) * M + R];
+                    if (L == rw)
                     {
-                        break;
+                        splits.score.resize(numChildren);
+                        if (needSolution)
+                        {
+                            splits.q.resize(numChildren);
+                        }
                     }
-                    for (int w = 0; w < n; ++w)
+                    for (int k = numChildren - static_cast<int>(candidates.crossing(rw, L).size()); k < numChildren; ++k)
                     {
-                        const auto &wInterval = intervals[w];
-                        const int lw = wInterval.Left;
-                        const int rw = wInterval.Right;
-                        if (!(lw < L && L <= rw && rw <= R))
+                        const int v = children[k];
+                        const auto &child = intervals[v];
+                        const int lv = child.Left;
+                        const int rv = child.Right;
+                        if (!(L <= lv && lv < rw && rw < rv && rv <= R))
                         {
                             continue;
                         }
-                        int best = getB(rw, R);
-                        SideChoice bestChoice;
-                        if (needSolution)
+                        if (lv == L)
                         {
-                            bestChoice.type = 1;
+                            fillSplitRow(splits, k, rightForest, w, v, rw, R);
                         }
-                        for (int v = 0; v < n; ++v)
+                        const auto &scores = splits.score[k];
+                        for (int p = lv; p < rw; ++p)
                         {
-                            if (v == w)
-                            {
-                                continue;
-                            }
-                            const auto &child = intervals[v];
-                            const int lv = child.Left;
-                            const int rv = child.Right;
-                            if (!(L <= lv && lv <= rw - 1 && rw + 1 <= rv && rv <= R))
-                            {
-                                continue;
-                            }
-                            for (int p = lv; p < rw; ++p)
+                            const int candidate = 1 + leftForest(v, L, p) + scores[p - lv];
+                            if (candidate > best)
                             {
-                                for (int q = rw + 1; q <= rv; ++q)
+                                best = candidate;
+                                if (needSolution)
                                 {
-                                    const int leftScore = leftForest(v, L, p);
-                                    const int rightScore = rightForest(v, q, R);
-                                    int middleScore = 0;
-                                    if (p + 1 <= q - 1)
-                                    {
-                                        middleScore = rightForest(w, p + 1, q - 1);
-                                    }
-                                    const int candidate = 1 + leftScore + rightScore + middleScore;
-                                    if (candidate > best)
-                                    {
-                                        best = candidate;
-                                        if (needSolution)
-                                        {
-                                            bestChoice.type = 2;
-                                            bestChoice.child = v;
-                                            bestChoice.p = p;
-                                            bestChoice.q = q;
-                                        }
-                                    }
+                                    bestChoice.type = 2;
+                                    bestChoice.child = v;
+                                    bestChoice.p = p;
+                                    bestChoice.q = splits.q[k][p - lv];
                                 }
                             }
                         }
-                        rightForest(w, L, R) = best;
-                        if (needSolution)
-                        {
-                            rfChoices(w, L, R) = bestChoice;
-                        }
+                    }
+                    if (L == lw + 1)
+                    {
+                        splits = SplitRows{};
+                    }
+                    rightForest(w, L, R) = static_cast<TScore>(best);
+                    if (needSolution)
+                    {
+                        rfChoices(w, L, R) = bestChoice;
                     }
                 }
 
-                for (int L = 0; L < M; ++L)
+                for (int w = 0; w < n; ++w)
                 {
-                    const int R = L + width;
-                    if (R >= M)
+                    const auto &wInterval = intervals[w];
+                    const int lw = wInterval.Left;
+                    const int rw = wInterval.Right;
+                    if (!(L <= lw && lw <= R && R < rw))
+                    {
+                        continue;
+                    }
+                    int best = getB(lw, R);
+                    SideChoice bestChoice;
+                    if (needSolution)
                     {
-                        break;
+                        bestChoice.type = 1;
                     }
-                    for (int w = 0; w < n; ++w)
+                    // Children v with L <= lv < lw < rv <= R: the ones with lv >= L are a suffix of the list.
+                    const auto children = candidates.crossing(lw);
+                    const int numChildren = static_cast<int>(children.size());
+                    auto &splits = leftSplits[static_cast<std::size_t>(w) * M + R];
+                    if (L == lw)
                     {
-                        const auto &wInterval = intervals[w];
-                        const int lw = wInterval.Left;
-                        const int rw = wInterval.Right;
-                        if (!(L <= lw && lw <= R && R < rw))
+                        splits.score.resize(numChildren);
+                        if (needSolution)
+                        {
+                            splits.q.resize(numChildren);
+                        }
+                    }
+                    for (int k = numChildren - static_cast<int>(candidates.crossing(lw, L).size()); k < numChildren; ++k)
+                    {
+                        const int v = children[k];
+                        const auto &child = intervals[v];
+                        const int lv = child.Left;
+                        const int rv = child.Right;
+                        if (!(L <= lv && lv < lw && lw < rv && rv <= R))
                         {
                             continue;
                         }
-                        int best = getB(lw, R);
-                        SideChoice bestChoice;
-                        if (needSolution)
+                        if (lv == L)
                         {
-                            bestChoice.type = 1;
+                            fillSplitRow(splits, k, leftForest, w, v, lw, R);
                         }
-                        for (int v = 0; v < n; ++v)
+                        const auto &scores = splits.score[k];
+                        for (int p = lv; p < lw; ++p)
                         {
-                            if (v == w)
-                            {
-                                continue;
-                            }
-                            const auto &child = intervals[v];
-                            const int lv = child.Left;
-                            const int rv = child.Right;
-                            if (!(L <= lv && lv <= lw - 1 && lw + 1 <= rv && rv <= R))
-                            {
-                                continue;
-                            }
-                            for (int p = lv; p < lw; ++p)
+                            const int candidate = 1 + leftForest(v, L, p) + scores[p - lv];
+                            if (candidate > best)
                             {
-                                for (int q = lw + 1; q <= rv; ++q)
+                                best = candidate;
+                                if (needSolution)
                                 {
-                                    const int leftScore = leftForest(v, L, p);
-                                    const int rightScore = rightForest(v, q, R);
-                                    int middleScore = 0;
-                                    if (p + 1 <= q - 1)
-                                    {
-                                        middleScore = leftForest(w, p + 1, q - 1);
-                                    }
-                                    const int candidate = 1 + leftScore + rightScore + middleScore;
-                                    if (candidate > best)
-                                    {
-                                        best = candidate;
-                                        if (needSolution)
-                                        {
-                                            bestChoice.type = 2;
-                                            bestChoice.child = v;
-                                            bestChoice.p = p;
-                                            bestChoice.q = q;
-                                        }
-                                    }
+                                    bestChoice.type = 2;
+                                    bestChoice.child = v;
+                                    bestChoice.p = p;
+                                    bestChoice.q = splits.q[k][p - lv];
                                 }
                             }
                         }
-                        leftForest(w, L, R) = best;
-                        if (needSolution)
-                        {
-                            lfChoices(w, L, R) = bestChoice;
-                        }
+                    }
+                    if (L == 0)
+                    {
+                        splits = SplitRows{};
+                    }
+                    leftForest(w, L, R) = static_cast<TScore>(best);
+                    if (needSolution)
+                    {
+                        lfChoices(w, L, R) = bestChoice;
                     }
                 }
+            };
+
+            cg::utils::ThreadPool pool(threadCount);
+            for (int width = 0; width <= M; ++width)
+            {
+                // a runs over [-1, M - 1) with R = a + width in [0, M).
+                const int firstA = width == 0 ? 0 : -1;
+                const int bCells = std::min(M - 1, M - width) - firstA;
+                pool.parallelFor(bCells, pool.chunkSizeFor(bCells), [&](int begin, int end)
+                {
+                    for (int i = begin; i < end; ++i)
+                    {
+                        computeBCell(firstA + i, firstA + i + width);
+                    }
+                });
+
+                const int forestCells = M - width;
+                pool.parallelFor(forestCells, pool.chunkSizeFor(forestCells), [&](int begin, int end)
+                {
+                    for (int L = begin; L < end; ++L)
+                    {
+                        computeForestCells(L, L + width);
+                    }
+                });
             }
 
             const int answer = getB(-1, M - 1);
@@ -382,17 +468,25 @@ namespace cg::mif
                          picked.end());
             return ComputationResult{answer, picked};
         }
+
+        ComputationResult computeMifWithNarrowestScores(const cg::data_structures::DistinctIntervalModel &intervalModel, bool needSolution, int threadCount)
+        {
+            return cg::utils::withNarrowestCell(intervalModel.allIntervals().size(), [&]<typename TScore>(TScore)
+            {
+                return computeMifInternal<TScore>(intervalModel, needSolution, threadCount);
+            });
+        }
     }
 
-    int NickSimplerMif::computeMifSize(const cg::data_structures::DistinctIntervalModel &intervalModel)
+    int NickSimplerMif::computeMifSize(const cg::data_structures::DistinctIntervalModel &intervalModel, int threadCount)
     {
-        return computeMifInternal(intervalModel, false).size;
+        return computeMifWithNarrowestScores(intervalModel, false, threadCount).size;
     }
 
     std::pair<int, std::vector<cg::data_structures::Interval>>
-    NickSimplerMif::computeMif(const cg::data_structures::DistinctIntervalModel &intervalModel)
+    NickSimplerMif::computeMif(const cg::data_structures::DistinctIntervalModel &intervalModel, int threadCount)
     {
-        const auto result = computeMifInternal(intervalModel, true);
+        const auto result = computeMifWithNarrowestScores(intervalModel, true, threadCount);
         return {result.size, result.picked};
     }
 }
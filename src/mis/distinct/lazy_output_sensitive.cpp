@@ -11,7 +11,9 @@
 #include "data_structures/interval.h"
 #include "data_structures/distinct_interval_model.h"
 #include "mis/implicit_independent_set.h"
+#include "mis/null_independent_set.h"
 #include "mis/monotone_seq.h"
+#include "mis/segment_tree_monotone_seq.h"
 #include "utils/counters.h"
 
 #include "mis/distinct/lazy_output_sensitive.h"
@@ -19,7 +21,8 @@
 
 namespace cg::mis::distinct
 {
-    bool LazyOutputSensitive::tryUpdate(const cg::data_structures::DistinctIntervalModel &intervals, int leftLimit, std::map<int, PendingUpdate> &pendingUpdates, ImplicitIndependentSet& independentSet, cg::mis::MonotoneSeq &MIS, std::vector<int> &CMIS, int maxAllowedMIS, cg::utils::Counters<Counts>& counts)
+    template <typename TIndependentSet, typename TMonotoneSeq>
+    bool LazyOutputSensitive::tryUpdate(const cg::data_structures::DistinctIntervalModel &intervals, int leftLimit, std::map<int, PendingUpdate> &pendingUpdates, TIndependentSet& independentSet, TMonotoneSeq &MIS, std::vector<int> &CMIS, int maxAllowedMIS, cg::utils::Counters<Counts>& counts)
     {
         int maxSoFar = -1;
 
@@ -50,7 +53,7 @@ namespace cg::mis::distinct
                 continue;
             }
 
-            cg::mis::MonotoneSeq::Range r = MIS.set(currentInterval.Left, currentIntervalCandidate);
+            typename TMonotoneSeq::Range r = MIS.set(currentInterval.Left, currentIntervalCandidate);
 
             int nextPending = -1;
             if(!pendingUpdates.empty())
@@ -60,34 +63,32 @@ namespace cg::mis::distinct
             }
 
             auto representativeMIS = currentIntervalCandidate;
-            auto maybeInterval = intervals.tryGetRightEndpointPredecessorInterval(currentInterval.Left);
-            while (maybeInterval)
+            // Walk the right end-points below currentInterval.Left in decreasing order, one predecessor load per step.
+            for (auto right = intervals.rightEndpointPredecessor(currentInterval.Left); right != cg::data_structures::DistinctIntervalModel::NoEndpoint; right = intervals.rightEndpointPredecessor(right))
             {
-                auto interval = maybeInterval.value();
-                if(interval.Right <= nextPending)
+                if(right <= nextPending)
                 {
                     counts.Increment(Counts::StackInnerLoop);
                     break;
                 }
 
-                if (interval.Left < r.changeStartInclusive && interval.Right >= r.changeStartInclusive)
+                const auto left = intervals.partnerEndpoint(right);
+                if (left < r.changeStartInclusive && right >= r.changeStartInclusive)
                 {
                     counts.Increment(Counts::StackInnerLoop);
-                    pendingUpdates.emplace(interval.Left, PendingUpdate{interval, -1});
+                    pendingUpdates.emplace(left, PendingUpdate{intervals.getIntervalByRightEndpoint(right), -1});
                 }
-                maybeInterval = intervals.tryGetRightEndpointPredecessorInterval(interval.Right);
             }
         }
         return true;
     }
 
-    std::optional<std::vector<cg::data_structures::Interval>> LazyOutputSensitive::tryComputeMIS(const cg::data_structures::DistinctIntervalModel &intervals, int maxAllowedMIS, cg::utils::Counters<Counts>& counts)
+    template <typename TMonotoneSeq, typename TIndependentSet>
+    std::optional<int> LazyOutputSensitive::tryComputeMISInternal(const cg::data_structures::DistinctIntervalModel &intervals, TIndependentSet& independentSet, int maxAllowedMIS, cg::utils::Counters<Counts>& counts)
     {
         std::map<int, PendingUpdate> pendingUpdates;
         std::vector<int> CMIS(intervals.size);
-        cg::mis::MonotoneSeq MIS(intervals.end+1);
-
-        cg::mis::ImplicitIndependentSet independentSet(intervals.size);
+        TMonotoneSeq MIS(intervals.end+1);
 
         for (auto i = 0; i < intervals.end; ++i)
         {
@@ -115,8 +116,32 @@ namespace cg::mis::distinct
             return std::nullopt;
         }
 
-        const auto& intervalsInMis = independentSet.buildIndependentSet(MIS.get(0));
+        return MIS.get(0);
+    }
+
+    template <typename TMonotoneSeq>
+    std::optional<std::vector<cg::data_structures::Interval>> LazyOutputSensitive::tryComputeMIS(const cg::data_structures::DistinctIntervalModel &intervals, int maxAllowedMIS, cg::utils::Counters<Counts>& counts)
+    {
+        cg::mis::ImplicitIndependentSet independentSet(intervals.size);
+        const auto maybeMisWeight = tryComputeMISInternal<TMonotoneSeq>(intervals, independentSet, maxAllowedMIS, counts);
+        if (!maybeMisWeight)
+        {
+            return std::nullopt;
+        }
+        const auto& intervalsInMis = independentSet.buildIndependentSet(maybeMisWeight.value());
 
         return intervalsInMis;
     }
+
+    template <typename TMonotoneSeq>
+    std::optional<int> LazyOutputSensitive::tryComputeMISSize(const cg::data_structures::DistinctIntervalModel &intervals, int maxAllowedMIS, cg::utils::Counters<Counts>& counts)
+    {
+        cg::mis::NullIndependentSet independentSet(intervals.size);
+        return tryComputeMISInternal<TMonotoneSeq>(intervals, independentSet, maxAllowedMIS, counts);
+    }
+
+    template std::optional<std::vector<cg::data_structures::Interval>> LazyOutputSensitive::tryComputeMIS<cg::mis::MonotoneSeq>(const cg::data_structures::DistinctIntervalModel &, int, cg::utils::Counters<Counts>&);
+    template std::optional<std::vector<cg::data_structures::Interval>> LazyOutputSensitive::tryComputeMIS<cg::mis::SegmentTreeMonotoneSeq>(const cg::data_structures::DistinctIntervalModel &, int, cg::utils::Counters<Counts>&);
+    template std::optional<int> LazyOutputSensitive::tryComputeMISSize<cg::mis::MonotoneSeq>(const cg::data_structures::DistinctIntervalModel &, int, cg::utils::Counters<Counts>&);
+    template std::optional<int> LazyOutputSensitive::tryComputeMISSize<cg::mis::SegmentTreeMonotoneSeq>(const cg::data_structures::DistinctIntervalModel &, int, cg::utils::Counters<Counts>&);
 }
@@ -4,27 +4,29 @@
 #include "data_structures/interval.h"
 #include "data_structures/distinct_interval_model.h"
 #include "mis/independent_set.h"
+#include "mis/null_independent_set.h"
 
 #include "mis/distinct/naive.h"
 
 namespace cg::mis::distinct
 {
-    void Naive::update(int i, cg::mis::IndependentSet &independentSet, const cg::data_structures::DistinctIntervalModel &intervals, std::vector<int> &MIS, std::vector<int> &CMIS)
+    template <typename TIndependentSet>
+    void Naive::update(int i, TIndependentSet &independentSet, const cg::data_structures::DistinctIntervalModel &intervals, std::vector<int> &MIS, std::vector<int> &CMIS)
     {
         for (auto j = i - 1; j >= 0; --j)
         {
             MIS[j] = MIS[j + 1];
             independentSet.setSameNextInterval(j);
-            auto maybeInterval = intervals.tryGetIntervalByLeftEndpoint(j);
-            if (maybeInterval)
+            if (intervals.isLeftEndpoint(j))
             {
-                auto interval = maybeInterval.value();
-                if (interval.Right <= i)
+                const auto right = intervals.partnerEndpoint(j);
+                if (right <= i)
                 {
-                    auto candidate = interval.Weight + CMIS[interval.Index] + MIS[interval.Right + 1];
+                    const auto index = intervals.intervalIndexAt(j);
+                    auto candidate = intervals.weightOf(index) + CMIS[index] + MIS[right + 1];
                     if (candidate > MIS[j + 1])
                     {
-                        independentSet.setNewNextInterval(j, interval);
+                        independentSet.setNewNextInterval(j, intervals.getIntervalByLeftEndpoint(j));
                         MIS[j] = candidate;
                     }
                 }
@@ -32,12 +34,11 @@ namespace cg::mis::distinct
         }
     }
 
-    std::vector<cg::data_structures::Interval> Naive::computeMIS(const cg::data_structures::DistinctIntervalModel& intervals)
+    template <typename TIndependentSet>
+    int Naive::computeMISInternal(const cg::data_structures::DistinctIntervalModel& intervals, TIndependentSet &independentSet)
     {
         std::vector<int> MIS(intervals.end + 1, 0);
         std::vector<int> CMIS(intervals.size, 0);
-        
-        cg::mis::IndependentSet independentSet(intervals.size);
 
         for(auto i = 0; i < intervals.end; ++i)
         {
@@ -50,8 +51,21 @@ namespace cg::mis::distinct
             }
             update(i, independentSet, intervals, MIS, CMIS);
         }
-        const auto& intervalsInMis = independentSet.buildIndependentSet(MIS[0]);
+        return MIS[0];
+    }
+
+    std::vector<cg::data_structures::Interval> Naive::computeMIS(const cg::data_structures::DistinctIntervalModel& intervals)
+    {
+        cg::mis::IndependentSet independentSet(intervals.size);
+        const auto misWeight = computeMISInternal(intervals, independentSet);
+        const auto& intervalsInMis = independentSet.buildIndependentSet(misWeight);
         return intervalsInMis;
     }
+
+    int Naive::computeMISSize(const cg::data_structures::DistinctIntervalModel& intervals)
+    {
+        cg::mis::NullIndependentSet independentSet(intervals.size);
+        return computeMISInternal(intervals, independentSet);
+    }
 }
 
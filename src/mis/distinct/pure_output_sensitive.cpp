@@ -7,6 +7,7 @@
 #include "data_structures/interval.h"
 #include "data_structures/distinct_interval_model.h"
 #include "mis/independent_set.h"
+#include "mis/null_independent_set.h"
 #include "utils/counters.h"
 
 #include "mis/distinct/pure_output_sensitive.h"
@@ -20,7 +21,8 @@ namespace cg::mis::distinct
         pendingUpdates.push(indexToUpdate);
     }
 
-    bool PureOutputSensitive::tryUpdate(const cg::data_structures::DistinctIntervalModel &intervals, std::stack<int> &pendingUpdates, IndependentSet& independentSet, const cg::data_structures::Interval &newInterval, std::vector<int> &MIS, std::vector<int> &CMIS, int maxAllowedMIS, cg::utils::Counters<Counts>& counts)
+    template <typename TIndependentSet>
+    bool PureOutputSensitive::tryUpdate(const cg::data_structures::DistinctIntervalModel &intervals, std::stack<int> &pendingUpdates, TIndependentSet& independentSet, const cg::data_structures::Interval &newInterval, std::vector<int> &MIS, std::vector<int> &CMIS, int maxAllowedMIS, cg::utils::Counters<Counts>& counts)
     {
         updateAt(pendingUpdates, MIS, newInterval.Left, newInterval.Weight + CMIS[newInterval.Index]);
         independentSet.setNewNextInterval(newInterval.Left, newInterval);
@@ -61,14 +63,13 @@ namespace cg::mis::distinct
         return true;
     }
 
-    std::optional<std::vector<cg::data_structures::Interval>> PureOutputSensitive::tryComputeMIS(const cg::data_structures::DistinctIntervalModel &intervals, int maxAllowedMIS, cg::utils::Counters<Counts>& counts)
+    template <typename TIndependentSet>
+    std::optional<int> PureOutputSensitive::tryComputeMISInternal(const cg::data_structures::DistinctIntervalModel &intervals, TIndependentSet& independentSet, int maxAllowedMIS, cg::utils::Counters<Counts>& counts)
     {
         std::vector<int> MIS(intervals.end, 0);
         std::vector<int> CMIS(intervals.size, 0);
         std::stack<int> pendingUpdates;
 
-        cg::mis::IndependentSet independentSet(intervals.size);
-
         for (auto i = 0; i < intervals.end; ++i)
         {
             counts.Increment(Counts::IntervalOuterLoop);
@@ -84,8 +85,25 @@ namespace cg::mis::distinct
                 }
             }
         }
-        const auto& intervalsInMis = independentSet.buildIndependentSet(MIS[0]);
+        return MIS[0];
+    }
+
+    std::optional<std::vector<cg::data_structures::Interval>> PureOutputSensitive::tryComputeMIS(const cg::data_structures::DistinctIntervalModel &intervals, int maxAllowedMIS, cg::utils::Counters<Counts>& counts)
+    {
+        cg::mis::IndependentSet independentSet(intervals.size);
+        const auto maybeMisWeight = tryComputeMISInternal(intervals, independentSet, maxAllowedMIS, counts);
+        if (!maybeMisWeight)
+        {
+            return std::nullopt;
+        }
+        const auto& intervalsInMis = independentSet.buildIndependentSet(maybeMisWeight.value());
 
         return intervalsInMis;
     }
+
+    std::optional<int> PureOutputSensitive::tryComputeMISSize(const cg::data_structures::DistinctIntervalModel &intervals, int maxAllowedMIS, cg::utils::Counters<Counts>& counts)
+    {
+        cg::mis::NullIndependentSet independentSet(intervals.size);
+        return tryComputeMISInternal(intervals, independentSet, maxAllowedMIS, counts);
+    }
 }
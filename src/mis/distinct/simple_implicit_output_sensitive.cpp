@@ -11,6 +11,7 @@
 #include "data_structures/distinct_interval_model.h"
 #include "mis/implicit_independent_set.h"
 #include "mis/unit_monotone_seq.h"
+#include "mis/flat_unit_monotone_seq.h"
 #include "utils/counters.h"
 
 #include "mis/distinct/simple_implicit_output_sensitive.h"
@@ -19,7 +20,8 @@
 namespace cg::mis::distinct
 {
 
-    bool SimpleImplicitOutputSensitive::tryUpdate(const cg::data_structures::DistinctIntervalModel &intervals, std::stack<cg::data_structures::Interval> &pendingUpdates, ImplicitIndependentSet& independentSet, const cg::data_structures::Interval &newInterval, cg::mis::UnitMonotoneSeq &MIS, std::vector<int> &CMIS, int maxAllowedMIS, cg::utils::Counters<Counts>& counts)
+    template <typename TUnitMonotoneSeq>
+    bool SimpleImplicitOutputSensitive::tryUpdate(const cg::data_structures::DistinctIntervalModel &intervals, std::stack<cg::data_structures::Interval> &pendingUpdates, ImplicitIndependentSet& independentSet, const cg::data_structures::Interval &newInterval, TUnitMonotoneSeq &MIS, std::vector<int> &CMIS, int maxAllowedMIS, cg::utils::Counters<Counts>& counts)
     {
         pendingUpdates.push(newInterval);
         while (!pendingUpdates.empty())
@@ -29,7 +31,7 @@ namespace cg::mis::distinct
             auto currentInterval = pendingUpdates.top();
             pendingUpdates.pop();
 
-            cg::mis::UnitMonotoneSeq::Range r = MIS.increment(currentInterval.Left);
+            typename TUnitMonotoneSeq::Range r = MIS.increment(currentInterval.Left);
 
             independentSet.setRange(r.left, r.right - 1, currentInterval);
 
@@ -63,11 +65,12 @@ namespace cg::mis::distinct
         return true;
     }
 
+    template <typename TUnitMonotoneSeq>
     std::optional<std::vector<cg::data_structures::Interval>> SimpleImplicitOutputSensitive::tryComputeMIS(const cg::data_structures::DistinctIntervalModel &intervals, int maxAllowedMIS, cg::utils::Counters<Counts>& counts)
     {
         std::stack<cg::data_structures::Interval> pendingUpdates;
         std::vector<int> CMIS(intervals.size);
-        cg::mis::UnitMonotoneSeq MIS(intervals.end);
+        TUnitMonotoneSeq MIS(intervals.end);
 
         cg::mis::ImplicitIndependentSet independentSet(intervals.size);
 
@@ -91,4 +94,7 @@ namespace cg::mis::distinct
 
         return intervalsInMis;
     }
+
+    template std::optional<std::vector<cg::data_structures::Interval>> SimpleImplicitOutputSensitive::tryComputeMIS<cg::mis::UnitMonotoneSeq>(const cg::data_structures::DistinctIntervalModel &, int, cg::utils::Counters<Counts>&);
+    template std::optional<std::vector<cg::data_structures::Interval>> SimpleImplicitOutputSensitive::tryComputeMIS<cg::mis::FlatUnitMonotoneSeq>(const cg::data_structures::DistinctIntervalModel &, int, cg::utils::Counters<Counts>&);
 }
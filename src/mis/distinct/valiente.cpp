@@ -4,18 +4,18 @@
 #include "data_structures/interval.h"
 #include "data_structures/distinct_interval_model.h"
 #include "mis/independent_set.h"
+#include "mis/null_independent_set.h"
 
 #include "mis/distinct/valiente.h"
 
 namespace cg::mis::distinct
 {
-    std::vector<cg::data_structures::Interval> Valiente::computeMIS(const cg::data_structures::DistinctIntervalModel& intervals)
+    template <typename TIndependentSet>
+    int Valiente::computeMISInternal(const cg::data_structures::DistinctIntervalModel& intervals, TIndependentSet &result)
     {
         std::vector<int> MIS(intervals.end + 1, 0);
         std::vector<int> CMIS(intervals.size, 0);
 
-        cg::mis::IndependentSet result(intervals.size);
-
         for(auto i = 0; i < intervals.end; ++i)
         {
             auto maybeOuterInterval = intervals.tryGetIntervalByRightEndpoint(i);
@@ -24,19 +24,19 @@ namespace cg::mis::distinct
                 auto outerInterval = maybeOuterInterval.value();
                 for(auto j = outerInterval.Right; j > outerInterval.Left; --j)
                 {
-                    auto maybeInnerInterval = intervals.tryGetIntervalByLeftEndpoint(j);
                     MIS[j] = MIS[j + 1];
                     result.setSameNextInterval(j);
-                    if(maybeInnerInterval)
+                    if(intervals.isLeftEndpoint(j))
                     {
-                        auto innerInterval = maybeInnerInterval.value();
-                        auto candidate = MIS[innerInterval.Right + 1] + CMIS[innerInterval.Index];
-                        if(innerInterval.Right < outerInterval.Right && // Strictly speaking, this bounds check could be removed because CMIS and MIS on the previous line
-                                                                        // will both be zero when it is false, but it's a bit confusing to write the code that way. 
+                        // Read the end-point columns directly, and only materialise the Interval when it improves MIS[j].
+                        const auto innerRight = intervals.partnerEndpoint(j);
+                        auto candidate = MIS[innerRight + 1] + CMIS[intervals.intervalIndexAt(j)];
+                        if(innerRight < outerInterval.Right && // Strictly speaking, this bounds check could be removed because CMIS and MIS on the previous line
+                                                               // will both be zero when it is false, but it's a bit confusing to write the code that way. 
                            candidate > MIS[j + 1])
                         {
                             MIS[j] = candidate;
-                            result.setNewNextInterval(j, innerInterval);
+                            result.setNewNextInterval(j, intervals.getIntervalByLeftEndpoint(j));
                         }
                     }
                 }
@@ -64,8 +64,21 @@ namespace cg::mis::distinct
             }
         }
 
-        const auto& intervalsInMis = result.buildIndependentSet(MIS[0]); 
+        return MIS[0];
+    }
+
+    std::vector<cg::data_structures::Interval> Valiente::computeMIS(const cg::data_structures::DistinctIntervalModel& intervals)
+    {
+        cg::mis::IndependentSet result(intervals.size);
+        const auto misWeight = computeMISInternal(intervals, result);
+        const auto& intervalsInMis = result.buildIndependentSet(misWeight); 
         
         return intervalsInMis;
     }
+
+    int Valiente::computeMISSize(const cg::data_structures::DistinctIntervalModel& intervals)
+    {
+        cg::mis::NullIndependentSet result(intervals.size);
+        return computeMISInternal(intervals, result);
+    }
 }
@@ -0,0 +1,82 @@
+#include <limits>
+#include <stdexcept>
+#include <format>
+
+#include "mis/flat_unit_monotone_seq.h"
+
+namespace cg::mis
+{
+    FlatUnitMonotoneSeq::FlatUnitMonotoneSeq(int size) : _runStarts(size + 2), _runStartToValue(size + 2), _size(size)
+    {
+        // The same three runs UnitMonotoneSeq starts with: an infinite sentinel at -1, the zero run and a -1 sentinel at _size.
+        _runStarts.insert(toPosition(-1));
+        _runStartToValue[toPosition(-1)] = std::numeric_limits<int>::max();
+        _runStarts.insert(toPosition(0));
+        _runStartToValue[toPosition(0)] = 0;
+        _runStarts.insert(toPosition(_size));
+        _runStartToValue[toPosition(_size)] = -1;
+    }
+
+    void FlatUnitMonotoneSeq::validateIndex(int idx)
+    {
+        if (idx < 0 || idx >= _size)
+        {
+            throw std::out_of_range(std::format("Index {} is out of range, should be between 0 and {} inclusive", idx, _size - 1));
+        }
+    }
+
+    [[nodiscard]] int FlatUnitMonotoneSeq::get(int idx)
+    {
+        validateIndex(idx);
+        return _runStartToValue[_runStarts.predecessor(toPosition(idx))];
+    }
+
+    FlatUnitMonotoneSeq::Range FlatUnitMonotoneSeq::increment(int idx)
+    {
+        validateIndex(idx);
+
+        const auto position = toPosition(idx);
+        const auto runStart = _runStarts.predecessor(position);
+        const auto oldValue = _runStartToValue[runStart];
+        const auto prevRunStart = _runStarts.predecessor(runStart - 1);
+        const auto nextRunStart = _runStarts.successor(runStart + 1);
+
+        int newEndRange;
+        if (position + 1 < nextRunStart)
+        {
+            _runStarts.insert(position + 1);
+            _runStartToValue[position + 1] = oldValue;
+            newEndRange = idx + 1;
+        }
+        else
+        {
+            newEndRange = toIndex(nextRunStart);
+        }
+
+        auto newBeginRange = toIndex(runStart);
+        if (_runStartToValue[prevRunStart] == oldValue + 1)
+        {
+            newBeginRange = toIndex(prevRunStart);
+            _runStarts.erase(runStart);
+        }
+        else
+        {
+            ++_runStartToValue[runStart];
+        }
+        return Range{newBeginRange, toIndex(runStart), newEndRange};
+    }
+
+    void FlatUnitMonotoneSeq::copyTo(std::vector<int> &target)
+    {
+        auto runStart = toPosition(0);
+        while (runStart < toPosition(_size))
+        {
+            const auto nextRunStart = _runStarts.successor(runStart + 1);
+            for (auto position = runStart; position < nextRunStart; ++position)
+            {
+                target[toIndex(position)] = _runStartToValue[runStart];
+            }
+            runStart = nextRunStart;
+        }
+    }
+}
@@ -9,54 +9,55 @@
 namespace cg::mis
 {
     ImplicitIndependentSet::ImplicitIndependentSet(int maxNumIntervals) // should accept a max interval end-point really instead
+        : _rangeRights(2 * maxNumIntervals + 3),
+          _rangeRightToLeft(2 * maxNumIntervals + 3),
+          _rangeRightToIndex(2 * maxNumIntervals + 3, NoInterval),
+          _lastRangeRight(2 * maxNumIntervals + 1)
     {
-        _intervalIndexToDirectlyContained.resize(maxNumIntervals);
-        _endpointToRange.emplace(-1, Range{-2,-1, cg::data_structures::Interval(-2, -1, 0, 0)});
-        _endpointToRange.emplace(2*maxNumIntervals+1, Range{2*maxNumIntervals,2*maxNumIntervals+1, cg::data_structures::Interval(2*maxNumIntervals, 2*maxNumIntervals+1, 0, 0)});
+        _indexToInterval.assign(maxNumIntervals, cg::data_structures::Interval(0, 1, 0, 0));
+        _indexToContainedHead.assign(maxNumIntervals, NoInterval);
+        // An interval is directly contained in at most two others (see below), so the arena never reallocates.
+        _containedArena.reserve(2 * maxNumIntervals);
+        insertRange(-2, -1, NoInterval);
+        insertRange(2 * maxNumIntervals, _lastRangeRight, NoInterval);
+    }
+
+    void ImplicitIndependentSet::insertRange(int left, int right, int intervalIndex)
+    {
+        _rangeRights.insert(toPosition(right));
+        _rangeRightToLeft[toPosition(right)] = left;
+        _rangeRightToIndex[toPosition(right)] = intervalIndex;
     }
 
     void ImplicitIndependentSet::setRange(int left, int right, const cg::data_structures::Interval& interval) 
     {        
-        
-        auto pred = _endpointToRange.upper_bound(right);
-        --pred;
-        auto predRange = pred->second; 
-        if(predRange.left < left) 
+        const auto pred = toEndpoint(_rangeRights.predecessor(toPosition(right)));
+        const auto predLeft = _rangeRightToLeft[toPosition(pred)];
+        const auto predIndex = _rangeRightToIndex[toPosition(pred)];
+        _rangeRights.erase(toPosition(pred));
+        // A range already ending at left - 1 is kept rather than overwritten, as the emplace into the old std::map did.
+        if(predLeft < left && !_rangeRights.contains(toPosition(left - 1))) 
         {
             // PPPPP
             //   LLLLL
-            pred->second.right = left - 1;
-            _endpointToRange.erase(pred);
-            _endpointToRange.emplace(left - 1, Range{predRange.left,left - 1, predRange.interval});
-        }
-        else //if(predRange.left == left)
-        {
-            // PPPPP
-            // LLLLLL
-            _endpointToRange.erase(pred);
+            insertRange(predLeft, left - 1, predIndex);
         }
-        /*else
-        {
-
-            //   PPPPP
-            // LLLLLL
-            throw std::runtime_error("SURPRISING");
-
-        }*/
+        // else
+        // PPPPP
+        // LLLLLL
 
-        auto next = _endpointToRange.upper_bound(right);
-        auto nextRange = next->second;
-        if(right < nextRange.right)
+        const auto next = nextRangeRight(right);
+        if(right < next)
         {
             //   NNNNNN
             // RRRRRR
-            next->second.left = right + 1;
+            _rangeRightToLeft[toPosition(next)] = right + 1;
         }
-        else if(right == nextRange.right)
+        else if(right == next)
         {
             //  NNNNN
             // RRRRRR
-            _endpointToRange.erase(next);
+            _rangeRights.erase(toPosition(next));
         }
         else
         {
@@ -65,13 +66,12 @@ namespace cg::mis
             throw std::runtime_error("SURPRISING2");
         }
 
-
-        auto [it, wasInserted] = _endpointToRange.emplace(right, Range{left,right, interval});
-    
-        if(!wasInserted)
+        if(_rangeRights.contains(toPosition(right)))
         {
-                      throw std::runtime_error("bug!");
+            throw std::runtime_error("bug!");
         }
+        _indexToInterval[interval.Index] = interval;
+        insertRange(left, right, interval.Index);
     }
 
     // It's worth a quick explanation of the space complexity implied by calling assembleContainedIndependentSet for each of k intervals.
@@ -82,24 +82,19 @@ namespace cg::mis
     // interval containing any interval, it would have to contain one of the other two, violating direct containment)
     void ImplicitIndependentSet::assembleContainedIndependentSet(const cg::data_structures::Interval &interval)
     {
-
-        auto maybeNext = _endpointToRange.upper_bound(interval.Left);
-      
-        auto &containedSet = _intervalIndexToDirectlyContained[interval.Index];
-        auto last = _endpointToRange.end();
-        --last;
-        while (maybeNext != last)
+        auto &head = _indexToContainedHead[interval.Index];
+        auto next = nextRangeRight(interval.Left);
+        while (next != _lastRangeRight)
         {
-            auto rangeHere = maybeNext->second;
-            if(rangeHere.right < interval.Left || rangeHere.left > interval.Right)
+            if(next < interval.Left || _rangeRightToLeft[toPosition(next)] > interval.Right)
             {
                 break;
             }
 
-            auto intervalHere = rangeHere.interval;
-            
-            containedSet.push_front(intervalHere);
-            maybeNext = _endpointToRange.upper_bound(intervalHere.Right);
+            const auto indexHere = _rangeRightToIndex[toPosition(next)];
+            _containedArena.push_back(ContainedNode{indexHere, head});
+            head = static_cast<int>(_containedArena.size()) - 1;
+            next = nextRangeRight(_indexToInterval[indexHere].Right);
         }
     }
 
@@ -108,29 +103,24 @@ namespace cg::mis
         std::vector<cg::data_structures::Interval> intervalsInMis; 
         intervalsInMis.reserve(expectedCardinality);
 
-        std::vector<cg::data_structures::Interval> pendingIntervals;
+        std::vector<int> pendingIntervals;
         pendingIntervals.reserve(expectedCardinality);
-        auto maybeInterval = _endpointToRange.begin();
-        ++maybeInterval; // skip sentinel.
-
-        auto last = _endpointToRange.end();
-        --last; // skip sentinel.
-        while(maybeInterval != last)
+        auto next = nextRangeRight(-1); // skip sentinel.
+        while(next != _lastRangeRight)
         {
-            const auto& interval = maybeInterval->second.interval;
-            pendingIntervals.push_back(interval);
+            const auto& interval = _indexToInterval[_rangeRightToIndex[toPosition(next)]];
+            pendingIntervals.push_back(interval.Index);
             while(!pendingIntervals.empty())
             {
-                const auto& newInterval = pendingIntervals.back();
+                const auto& newInterval = _indexToInterval[pendingIntervals.back()];
                 pendingIntervals.pop_back();
                 intervalsInMis.push_back(newInterval);
-                const auto& allContained = _intervalIndexToDirectlyContained[newInterval.Index];
-                for(auto c : allContained)
+                for(auto node = _indexToContainedHead[newInterval.Index]; node != NoInterval; node = _containedArena[node].next)
                 {   
-                    pendingIntervals.push_back(c);
+                    pendingIntervals.push_back(_containedArena[node].intervalIndex);
                 }
             }
-            maybeInterval = _endpointToRange.upper_bound(interval.Right);
+            next = nextRangeRight(interval.Right);
         }
         (void)expectedCardinality;
         cg::interval_model_utils::verifyNoOverlaps(intervalsInMis);
@@ -10,18 +10,21 @@ namespace cg::mis
 {
     IndependentSet::IndependentSet(int maxNumIntervals) // should accept a max interval end-point really instead
     {
-        _endpointToInterval.resize(2 * maxNumIntervals + 1);
-        _intervalIndexToDirectlyContained.resize(maxNumIntervals);
+        _endpointToNextIndex.assign(2 * maxNumIntervals + 1, NoInterval);
+        _indexToInterval.assign(maxNumIntervals, cg::data_structures::Interval(0, 1, 0, 0));
+        _indexToContainedHead.assign(maxNumIntervals, NoInterval);
+        _containedArena.reserve(maxNumIntervals);
     }
 
     void IndependentSet::setSameNextInterval(int where)
     {
-        _endpointToInterval[where] = _endpointToInterval[where + 1];
+        _endpointToNextIndex[where] = _endpointToNextIndex[where + 1];
     }
 
     void IndependentSet::setNewNextInterval(int where, const cg::data_structures::Interval& interval) 
     {
-        _endpointToInterval[where] = interval;
+        _endpointToNextIndex[where] = interval.Index;
+        _indexToInterval[interval.Index] = interval;
     }
 
     // It's worth a quick explanation of the space complexity implied by calling assembleContainedIndependentSet for each of k intervals.
@@ -34,13 +37,14 @@ namespace cg::mis
     // WTF FIX THIS COMMENT!!!!
     void IndependentSet::assembleContainedIndependentSet(const cg::data_structures::Interval &interval)
     {
-        std::optional<cg::data_structures::Interval> maybeNext = _endpointToInterval[interval.Left + 1];
-        auto &containedSet = _intervalIndexToDirectlyContained[interval.Index];
-        while (maybeNext)
+        _indexToInterval[interval.Index] = interval;
+        auto &head = _indexToContainedHead[interval.Index];
+        auto next = _endpointToNextIndex[interval.Left + 1];
+        while (next != NoInterval)
         {
-            const auto& next = maybeNext.value();
-            containedSet.push_front(next);
-            maybeNext = _endpointToInterval[next.Right + 1];
+            _containedArena.push_back(ContainedNode{next, head});
+            head = static_cast<int>(_containedArena.size()) - 1;
+            next = _endpointToNextIndex[_indexToInterval[next].Right + 1];
         }
     }
 
@@ -48,29 +52,27 @@ namespace cg::mis
     {
         std::vector<cg::data_structures::Interval> intervalsInMis; 
 
-        std::vector<cg::data_structures::Interval> pendingIntervals;
-        auto maybeInterval = _endpointToInterval[0];
+        std::vector<int> pendingIntervals;
+        auto next = _endpointToNextIndex[0];
         auto totalWeight = 0L;
-        while(maybeInterval)
+        while(next != NoInterval)
         {
-            const auto& interval = maybeInterval.value();
-            pendingIntervals.push_back(interval);
+            pendingIntervals.push_back(next);
             while(!pendingIntervals.empty())
             {
-                const auto& newInterval = pendingIntervals.back();
+                const auto& newInterval = _indexToInterval[pendingIntervals.back()];
                 pendingIntervals.pop_back();
                 intervalsInMis.push_back(newInterval);
                 totalWeight += newInterval.Weight;
-                const auto& allContained = _intervalIndexToDirectlyContained[newInterval.Index];
-                for(auto c : allContained)
+                for(auto node = _indexToContainedHead[newInterval.Index]; node != NoInterval; node = _containedArena[node].next)
                 {   
-                    pendingIntervals.push_back(c);
+                    pendingIntervals.push_back(_containedArena[node].intervalIndex);
                 }
             }
-            maybeInterval = _endpointToInterval[interval.Right + 1];
+            next = _endpointToNextIndex[_indexToInterval[next].Right + 1];
         }
         (void)expectedWeight;
         cg::interval_model_utils::verifyNoOverlaps(intervalsInMis);
         return intervalsInMis;
     }
-}
\ No newline at end of file
+}
@@ -0,0 +1,151 @@
+#include <algorithm>
+#include <stdexcept>
+#include <format>
+
+#include "mis/segment_tree_monotone_seq.h"
+
+namespace cg::mis
+{
+    SegmentTreeMonotoneSeq::SegmentTreeMonotoneSeq(int size) : _size(size), _numLeaves(1)
+    {
+        // Like MonotoneSeq, index _size is readable and always 0. Padding leaves past it hold the smallest int so the
+        // whole tree stays non-increasing and firstIndexBelow always finds an answer.
+        while (_numLeaves < _size + 1)
+        {
+            _numLeaves *= 2;
+        }
+        _min.assign(2 * _numLeaves, std::numeric_limits<int>::min());
+        _pending.assign(2 * _numLeaves, NoPending);
+        std::fill(_min.begin() + _numLeaves, _min.begin() + _numLeaves + _size + 1, 0);
+        for (auto node = _numLeaves - 1; node >= 1; --node)
+        {
+            _min[node] = std::min(_min[2 * node], _min[2 * node + 1]);
+        }
+    }
+
+    void SegmentTreeMonotoneSeq::assignNode(int node, int value)
+    {
+        _min[node] = value;
+        _pending[node] = value;
+    }
+
+    void SegmentTreeMonotoneSeq::pushDown(int node)
+    {
+        if (_pending[node] != NoPending)
+        {
+            assignNode(2 * node, _pending[node]);
+            assignNode(2 * node + 1, _pending[node]);
+            _pending[node] = NoPending;
+        }
+    }
+
+    void SegmentTreeMonotoneSeq::assign(int node, int nodeLeft, int nodeRight, int left, int right, int value)
+    {
+        if (right < nodeLeft || nodeRight < left)
+        {
+            return;
+        }
+        if (left <= nodeLeft && nodeRight <= right)
+        {
+            assignNode(node, value);
+            return;
+        }
+        pushDown(node);
+        const auto middle = nodeLeft + (nodeRight - nodeLeft) / 2;
+        assign(2 * node, nodeLeft, middle, left, right, value);
+        assign(2 * node + 1, middle + 1, nodeRight, left, right, value);
+        _min[node] = std::min(_min[2 * node], _min[2 * node + 1]);
+    }
+
+    int SegmentTreeMonotoneSeq::firstIndexBelow(int value) const
+    {
+        // The sequence is non-increasing, so the indices below value form a suffix and the left child is taken
+        // whenever it already contains one.
+        auto node = 1;
+        auto nodeLeft = 0;
+        auto width = _numLeaves;
+        while (width > 1)
+        {
+            if (_pending[node] != NoPending)
+            {
+                return nodeLeft;
+            }
+            width /= 2;
+            if (_min[2 * node] < value)
+            {
+                node = 2 * node;
+            }
+            else
+            {
+                node = 2 * node + 1;
+                nodeLeft += width;
+            }
+        }
+        return nodeLeft;
+    }
+
+    [[nodiscard]] int SegmentTreeMonotoneSeq::get(int idx)
+    {
+        auto node = 1;
+        auto nodeLeft = 0;
+        auto width = _numLeaves;
+        while (width > 1)
+        {
+            if (_pending[node] != NoPending)
+            {
+                return _pending[node];
+            }
+            width /= 2;
+            node *= 2;
+            if (idx >= nodeLeft + width)
+            {
+                ++node;
+                nodeLeft += width;
+            }
+        }
+        return _min[node];
+    }
+
+    SegmentTreeMonotoneSeq::Range SegmentTreeMonotoneSeq::set(int idx, int value)
+    {
+        if (idx < 0 || idx >= _size)
+        {
+            throw std::out_of_range(std::format("Index {} is out of range, should be between 0 and {} inclusive", idx, _size - 1));
+        }
+        const auto current = get(idx);
+        if(current >= value)
+        {
+            throw std::out_of_range(std::format("Cannot set value {} at index {} to value, {} that is not strictly larger", current, idx, value));
+        }
+        const auto changeStart = firstIndexBelow(value);
+        assign(1, 0, _numLeaves - 1, changeStart, idx, value);
+
+        return Range{changeStart, idx + 1};
+    }
+
+    void SegmentTreeMonotoneSeq::collect(int node, int nodeLeft, int nodeRight, int inherited, std::vector<int> &target) const
+    {
+        if (nodeLeft >= _size)
+        {
+            return;
+        }
+        if (inherited == NoPending)
+        {
+            inherited = _pending[node];
+        }
+        if (nodeLeft == nodeRight)
+        {
+            target[nodeLeft] = inherited != NoPending ? inherited : _min[node];
+            return;
+        }
+        const auto middle = nodeLeft + (nodeRight - nodeLeft) / 2;
+        collect(2 * node, nodeLeft, middle, inherited, target);
+        collect(2 * node + 1, middle + 1, nodeRight, inherited, target);
+    }
+
+    void SegmentTreeMonotoneSeq::copyTo(std::vector<int> &target)
+    {
+        target.assign(_size, 0);
+        collect(1, 0, _numLeaves - 1, NoPending, target);
+    }
+}
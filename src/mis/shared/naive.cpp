@@ -3,6 +3,7 @@
 #include "data_structures/shared_interval_model.h"
 #include "data_structures/interval.h"
 #include "mis/independent_set.h"
+#include "mis/null_independent_set.h"
 #include "utils/counters.h"
 
 #include "mis/shared/naive.h"
@@ -36,18 +37,18 @@ namespace cg::mis::shared
     }
 
 
-    std::vector<cg::data_structures::Interval> Naive::computeMIS(const cg::data_structures::SharedIntervalModel& intervals, cg::utils::Counters<Counts>& counts)
+    template <typename TIndependentSet>
+    int Naive::computeMISInternal(const cg::data_structures::SharedIntervalModel &intervals, TIndependentSet &independentSet, cg::utils::Counters<Counts>& counts)
     {
         std::vector<int> MIS(1 + intervals.end, 0);
         std::vector<int> CMIS(intervals.size, 0);
-        cg::mis::IndependentSet independentSet(intervals.size);
 
         for(auto right = 1; right < intervals.end + 1; ++right)
         {
             for(auto here = right - 1; here >= 0; --here)
             {
                 counts.Increment(Counts::InnerLoop);
-                const auto& intervalsWithLeftEndpointHere = intervals.getAllIntervalsWithLeftEndpoint(here);
+                const auto& intervalsWithLeftEndpointHere = intervals.intervalsWithLeftEndpoint(here);
                 
                 for(const auto& interval : intervalsWithLeftEndpointHere)
                 {
@@ -74,8 +75,21 @@ namespace cg::mis::shared
                 }
             }
         }
-        auto intervalsInMis = independentSet.buildIndependentSet(MIS[0]);
+        return MIS[0];
+    }
+
+    std::vector<cg::data_structures::Interval> Naive::computeMIS(const cg::data_structures::SharedIntervalModel &intervals, cg::utils::Counters<Counts>& counts)
+    {
+        cg::mis::IndependentSet independentSet(intervals.size);
+        const auto misWeight = computeMISInternal(intervals, independentSet, counts);
+        auto intervalsInMis = independentSet.buildIndependentSet(misWeight);
         return intervalsInMis;
     }
+
+    int Naive::computeMISSize(const cg::data_structures::SharedIntervalModel &intervals, cg::utils::Counters<Counts>& counts)
+    {
+        cg::mis::NullIndependentSet independentSet(intervals.size);
+        return computeMISInternal(intervals, independentSet, counts);
+    }
 }
 
@@ -8,6 +8,7 @@
 #include "data_structures/shared_interval_model.h"
 #include "data_structures/interval.h"
 #include "mis/independent_set.h"
+#include "mis/null_independent_set.h"
 
 #include "mis/shared/pruned_output_sensitive.h"
 
@@ -25,7 +26,8 @@ namespace cg::mis::shared
         pendingUpdates.push(indexToUpdate);
     }
 
-    bool PrunedOutputSensitive::tryUpdate(const cg::data_structures::SharedIntervalModel &intervals, std::stack<int> &pendingUpdates, IndependentSet &independentSet, std::vector<int> &MIS, std::vector<int> &CMIS, int maxAllowedMIS, cg::utils::Counters<Counts>& counts, std::vector<std::list<cg::data_structures::Interval>>& indexToRelevantIntervals)
+    template <typename TIndependentSet>
+    bool PrunedOutputSensitive::tryUpdate(const cg::data_structures::SharedIntervalModel &intervals, std::stack<int> &pendingUpdates, TIndependentSet &independentSet, std::vector<int> &MIS, std::vector<int> &CMIS, int maxAllowedMIS, cg::utils::Counters<Counts>& counts, std::vector<std::list<cg::data_structures::Interval>>& indexToRelevantIntervals)
     {
         while (!pendingUpdates.empty())
         {
@@ -61,18 +63,17 @@ namespace cg::mis::shared
         return true;
     }
 
-    std::optional<std::vector<cg::data_structures::Interval>> PrunedOutputSensitive::tryComputeMIS(const cg::data_structures::SharedIntervalModel &intervals, int maxAllowedMIS, cg::utils::Counters<Counts>& counts)
+    template <typename TIndependentSet>
+    std::optional<int> PrunedOutputSensitive::tryComputeMISInternal(const cg::data_structures::SharedIntervalModel &intervals, TIndependentSet& independentSet, int maxAllowedMIS, cg::utils::Counters<Counts>& counts)
     {
         std::vector<int> MIS(intervals.end, 0);
         std::vector<int> CMIS(intervals.size, 0);
         std::stack<int> pendingUpdates;
         std::vector<std::list<cg::data_structures::Interval>> indexToRelevantIntervals(intervals.end + 1);
 
-        cg::mis::IndependentSet independentSet(intervals.size);
-      
         for(auto right = 1; right < intervals.end + 1; ++right)
         {
-            const auto& intervalsWithThisRightEndpoint = intervals.getAllIntervalsWithRightEndpoint(right - 1);
+            const auto intervalsWithThisRightEndpoint = intervals.intervalsWithRightEndpoint(right - 1);
             for(auto interval : intervalsWithThisRightEndpoint) // Longest to shortest
             {
                 CMIS[interval.Index] = MIS[interval.Left + 1];
@@ -101,7 +102,24 @@ namespace cg::mis::shared
                 return std::nullopt;
             }
         }
-        const auto& intervalsInMis = independentSet.buildIndependentSet(MIS[0]);
+        return MIS[0];
+    }
+
+    std::optional<std::vector<cg::data_structures::Interval>> PrunedOutputSensitive::tryComputeMIS(const cg::data_structures::SharedIntervalModel &intervals, int maxAllowedMIS, cg::utils::Counters<Counts>& counts)
+    {
+        cg::mis::IndependentSet independentSet(intervals.size);
+        const auto maybeMisWeight = tryComputeMISInternal(intervals, independentSet, maxAllowedMIS, counts);
+        if (!maybeMisWeight)
+        {
+            return std::nullopt;
+        }
+        const auto& intervalsInMis = independentSet.buildIndependentSet(maybeMisWeight.value());
         return intervalsInMis;
     }
+
+    std::optional<int> PrunedOutputSensitive::tryComputeMISSize(const cg::data_structures::SharedIntervalModel &intervals, int maxAllowedMIS, cg::utils::Counters<Counts>& counts)
+    {
+        cg::mis::NullIndependentSet independentSet(intervals.size);
+        return tryComputeMISInternal(intervals, independentSet, maxAllowedMIS, counts);
+    }
 }
@@ -7,6 +7,7 @@
 #include "data_structures/shared_interval_model.h"
 #include "data_structures/interval.h"
 #include "mis/independent_set.h"
+#include "mis/null_independent_set.h"
 
 #include "mis/shared/pure_output_sensitive.h"
 
@@ -25,7 +26,8 @@ namespace cg::mis::shared
         pendingUpdates.push(indexToUpdate);
     }
 
-    bool PureOutputSensitive::tryUpdate(const cg::data_structures::SharedIntervalModel &intervals, std::stack<int> &pendingUpdates, IndependentSet &independentSet, const cg::data_structures::Interval &newInterval, std::vector<int> &MIS, std::vector<int> &CMIS, int maxAllowedMIS, cg::utils::Counters<Counts>& counts)
+    template <typename TIndependentSet>
+    bool PureOutputSensitive::tryUpdate(const cg::data_structures::SharedIntervalModel &intervals, std::stack<int> &pendingUpdates, TIndependentSet &independentSet, const cg::data_structures::Interval &newInterval, std::vector<int> &MIS, std::vector<int> &CMIS, int maxAllowedMIS, cg::utils::Counters<Counts>& counts)
     {
         const auto candidate = newInterval.Weight + CMIS[newInterval.Index];
         if (candidate > MIS[newInterval.Left])
@@ -48,7 +50,7 @@ namespace cg::mis::shared
                 updateAt(pendingUpdates, MIS, leftNeighbour, MIS[updatedIndex]);
                 independentSet.setSameNextInterval(leftNeighbour);
             }
-            const auto &relevantIntervals = intervals.getAllIntervalsWithRightEndpoint(leftNeighbour);
+            const auto relevantIntervals = intervals.intervalsWithRightEndpoint(leftNeighbour);
             for (auto interval : relevantIntervals)
             {
                 counts.Increment(Counts::StackInnerLoop);
@@ -67,17 +69,16 @@ namespace cg::mis::shared
         return true;
     }
 
-    std::optional<std::vector<cg::data_structures::Interval>> PureOutputSensitive::tryComputeMIS(const cg::data_structures::SharedIntervalModel &intervals, int maxAllowedMIS, cg::utils::Counters<Counts>& counts)
+    template <typename TIndependentSet>
+    std::optional<int> PureOutputSensitive::tryComputeMISInternal(const cg::data_structures::SharedIntervalModel &intervals, TIndependentSet& independentSet, int maxAllowedMIS, cg::utils::Counters<Counts>& counts)
     {
         std::vector<int> MIS(intervals.end, 0);
         std::vector<int> CMIS(intervals.size, 0);
         std::stack<int> pendingUpdates;
 
-        cg::mis::IndependentSet independentSet(intervals.size);
-
         for(auto right = 1; right < intervals.end + 1; ++right)
         {
-            const auto& intervalsWithThisRightEndpoint = intervals.getAllIntervalsWithRightEndpoint(right - 1);
+            const auto intervalsWithThisRightEndpoint = intervals.intervalsWithRightEndpoint(right - 1);
             for(auto newInterval : intervalsWithThisRightEndpoint)
             {
                 CMIS[newInterval.Index] = MIS[newInterval.Left + 1];
@@ -89,7 +90,24 @@ namespace cg::mis::shared
                 }
             }
         }
-        const auto& intervalsInMis = independentSet.buildIndependentSet(MIS[0]);
+        return MIS[0];
+    }
+
+    std::optional<std::vector<cg::data_structures::Interval>> PureOutputSensitive::tryComputeMIS(const cg::data_structures::SharedIntervalModel &intervals, int maxAllowedMIS, cg::utils::Counters<Counts>& counts)
+    {
+        cg::mis::IndependentSet independentSet(intervals.size);
+        const auto maybeMisWeight = tryComputeMISInternal(intervals, independentSet, maxAllowedMIS, counts);
+        if (!maybeMisWeight)
+        {
+            return std::nullopt;
+        }
+        const auto& intervalsInMis = independentSet.buildIndependentSet(maybeMisWeight.value());
         return intervalsInMis;
     }
+
+    std::optional<int> PureOutputSensitive::tryComputeMISSize(const cg::data_structures::SharedIntervalModel &intervals, int maxAllowedMIS, cg::utils::Counters<Counts>& counts)
+    {
+        cg::mis::NullIndependentSet independentSet(intervals.size);
+        return tryComputeMISInternal(intervals, independentSet, maxAllowedMIS, counts);
+    }
 }
@@ -5,6 +5,7 @@
 #include "data_structures/shared_interval_model.h"
 #include "data_structures/interval.h"
 #include "mis/independent_set.h"
+#include "mis/null_independent_set.h"
 #include "utils/counters.h"
 
 #include "mis/shared/valiente.h"
@@ -32,22 +33,22 @@ namespace cg::mis::shared
         return maxInterval;
     }
 
-    std::vector<cg::data_structures::Interval> Valiente::computeMIS(const cg::data_structures::SharedIntervalModel &intervals, cg::utils::Counters<Counts> &counts)
+    template <typename TIndependentSet>
+    int Valiente::computeMISInternal(const cg::data_structures::SharedIntervalModel &intervals, TIndependentSet &independentSet, cg::utils::Counters<Counts>& counts)
     {
         std::vector<int> MIS(1 + intervals.end, 0);
         std::vector<int> CMIS(intervals.size, 0);
-        cg::mis::IndependentSet independentSet(intervals.size);
 
         for (auto right = 1; right < intervals.end + 1; ++right)
         {
-            const auto &rightIntervals = intervals.getAllIntervalsWithRightEndpoint(right - 1);
+            const auto rightIntervals = intervals.intervalsWithRightEndpoint(right - 1);
             if (rightIntervals.size() > 0)
             {
                 const auto &longest = rightIntervals[0];
                 for (auto here = longest.Right - 1; here > longest.Left; --here)
                 {
                     counts.Increment(Counts::InnerLoop);
-                    const auto &intervalsWithLeftEndpointHere = intervals.getAllIntervalsWithLeftEndpoint(here);
+                    const auto intervalsWithLeftEndpointHere = intervals.intervalsWithLeftEndpoint(here);
                     const auto &maybeMaxInterval = getMaxInterval(intervalsWithLeftEndpointHere, right - 1, MIS, CMIS, counts);
                     independentSet.setSameNextInterval(here);
                     MIS[here] = MIS[here + 1];
@@ -71,11 +72,11 @@ namespace cg::mis::shared
         }
         for(auto left = intervals.end - 1; left >= 0; --left)
         {
-            auto leftIntervals = intervals.getAllIntervalsWithLeftEndpoint(left);
+            const auto leftIntervals = intervals.intervalsWithLeftEndpoint(left);
             independentSet.setSameNextInterval(left);
             MIS[left] = MIS[left + 1];
             
-            for(auto interval : leftIntervals)
+            for(const auto& interval : leftIntervals)
             {
                 auto candidate = MIS[interval.Right + 1] + CMIS[interval.Index];
                 if(candidate > MIS[left + 1])
@@ -85,7 +86,20 @@ namespace cg::mis::shared
                 }
             }
         }
-        auto intervalsInMis = independentSet.buildIndependentSet(MIS[0]);
+        return MIS[0];
+    }
+
+    std::vector<cg::data_structures::Interval> Valiente::computeMIS(const cg::data_structures::SharedIntervalModel &intervals, cg::utils::Counters<Counts>& counts)
+    {
+        cg::mis::IndependentSet independentSet(intervals.size);
+        const auto misWeight = computeMISInternal(intervals, independentSet, counts);
+        auto intervalsInMis = independentSet.buildIndependentSet(misWeight);
         return intervalsInMis;
     }
+
+    int Valiente::computeMISSize(const cg::data_structures::SharedIntervalModel &intervals, cg::utils::Counters<Counts>& counts)
+    {
+        cg::mis::NullIndependentSet independentSet(intervals.size);
+        return computeMISInternal(intervals, independentSet, counts);
+    }
 }
@@ -0,0 +1,54 @@
+#include "utils/component_decomposition.h"
+#include "utils/components.h"
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+namespace cg::components
+{
+    std::vector<Component> decompose(const cg::data_structures::DistinctIntervalModel &intervalModel)
+    {
+        auto parts = getConnectedComponents(intervalModel.allIntervals());
+        // Largest first, so a thread pool starts on the most expensive components and the small ones fill the gaps.
+        std::stable_sort(parts.begin(), parts.end(), [](const auto &lhs, const auto &rhs)
+        {
+            return lhs.size() > rhs.size();
+        });
+
+        std::vector<Component> components;
+        components.reserve(parts.size());
+        for (auto &part : parts)
+        {
+            std::sort(part.begin(), part.end(), [](const auto &lhs, const auto &rhs)
+            {
+                return lhs.Left < rhs.Left;
+            });
+
+            std::vector<int> endpoints;
+            endpoints.reserve(2 * part.size());
+            for (const auto &interval : part)
+            {
+                endpoints.push_back(interval.Left);
+                endpoints.push_back(interval.Right);
+            }
+            std::sort(endpoints.begin(), endpoints.end());
+            const auto rank = [&](int endpoint)
+            {
+                return static_cast<int>(std::lower_bound(endpoints.begin(), endpoints.end(), endpoint) - endpoints.begin());
+            };
+
+            std::vector<cg::data_structures::Interval> remapped;
+            std::vector<int> originalIndex;
+            remapped.reserve(part.size());
+            originalIndex.reserve(part.size());
+            for (const auto &interval : part)
+            {
+                remapped.emplace_back(rank(interval.Left), rank(interval.Right), static_cast<int>(remapped.size()), interval.Weight);
+                originalIndex.push_back(interval.Index);
+            }
+            components.push_back(Component{cg::data_structures::DistinctIntervalModel(remapped), std::move(originalIndex)});
+        }
+        return components;
+    }
+}
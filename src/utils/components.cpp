@@ -5,11 +5,56 @@
 #include <set>
 #include <stack>
 #include <algorithm>
+#include <numeric>
 
 #include <iostream>
 
 namespace cg::components
 {
+    namespace
+    {
+        // Disjoint-set forest over positions in the input, with union by size and path halving.
+        class DisjointSets
+        {
+            std::vector<int> _parent;
+            std::vector<int> _size;
+
+        public:
+            explicit DisjointSets(int n) : _parent(n), _size(n, 1)
+            {
+                std::iota(_parent.begin(), _parent.end(), 0);
+            }
+
+            int find(int v)
+            {
+                while (_parent[v] != v)
+                {
+                    _parent[v] = _parent[_parent[v]];
+                    v = _parent[v];
+                }
+                return v;
+            }
+
+            // Joins the sets of a and b and returns the root of the union.
+            int unite(int a, int b)
+            {
+                a = find(a);
+                b = find(b);
+                if (a == b)
+                {
+                    return a;
+                }
+                if (_size[a] < _size[b])
+                {
+                    std::swap(a, b);
+                }
+                _parent[b] = a;
+                _size[a] += _size[b];
+                return a;
+            }
+        };
+    }
+
     // This is the naive algorithm for computing the connected components of a circle graph, requiring O(n^2) time and space.
     std::vector<std::vector<cg::data_structures::Interval>> getConnectedComponentsNaive(std::span<const cg::data_structures::Interval> intervals)
     {
@@ -153,4 +198,78 @@ namespace cg::components
         }
         return completeComponents;
     }
+
+    // The O(n \alpha(n)) time alternative to getConnectedComponents, with no per-interval allocation.
+    //
+    // The end-points are bucketed (they are 0..2n-1) and swept left to right, keeping a stack of (component, max-right)
+    // pairs. Every interval pushes its own component at its left end-point, and the stack stays ordered by left
+    // end-point: all intervals of a component lie above all intervals of the components below it. When interval u
+    // closes, each component above u's one started after u and still has an open interval (the one reaching its
+    // max-right), which crosses u, so they are all merged into u's component. Conversely u crosses only intervals that
+    // opened after it and are still open, which are all in those components. A component whose max-right is reached
+    // has no open intervals left and is dropped, since no later interval can cross it.
+    ComponentLabels getConnectedComponentLabels(std::span<const cg::data_structures::Interval> intervals)
+    {
+        cg::interval_model_utils::verifyEndpointsInRange(intervals);
+        cg::interval_model_utils::verifyEndpointsUnique(intervals);
+
+        const auto n = static_cast<int>(intervals.size());
+        // The position of the interval with each end-point, complemented for right end-points.
+        std::vector<int> atEndpoint(2 * intervals.size());
+        for (auto i = 0; i < n; ++i)
+        {
+            atEndpoint[intervals[i].Left] = i;
+            atEndpoint[intervals[i].Right] = ~i;
+        }
+
+        struct OpenComponent
+        {
+            int member;
+            int maxRight;
+        };
+        std::vector<OpenComponent> open;
+        DisjointSets sets(n);
+        for (auto endpoint = 0; endpoint < 2 * n; ++endpoint)
+        {
+            const auto at = atEndpoint[endpoint];
+            if (at >= 0)
+            {
+                open.push_back({at, intervals[at].Right});
+                continue;
+            }
+            const auto closing = ~at;
+            auto top = open.back();
+            open.pop_back();
+            auto root = sets.find(top.member);
+            while (sets.find(closing) != root)
+            {
+                const auto below = open.back();
+                open.pop_back();
+                root = sets.unite(below.member, root);
+                top.maxRight = std::max(top.maxRight, below.maxRight);
+            }
+            if (top.maxRight != endpoint)
+            {
+                open.push_back({root, top.maxRight});
+            }
+        }
+
+        ComponentLabels result{0, std::vector<int>(n)};
+        std::vector<int> componentOfRoot(n, -1);
+        for (auto endpoint = 0; endpoint < 2 * n; ++endpoint)
+        {
+            const auto at = atEndpoint[endpoint];
+            if (at < 0)
+            {
+                continue;
+            }
+            auto &component = componentOfRoot[sets.find(at)];
+            if (component < 0)
+            {
+                component = result.numComponents++;
+            }
+            result.labels[at] = component;
+        }
+        return result;
+    }
 }
\ No newline at end of file
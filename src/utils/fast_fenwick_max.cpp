@@ -0,0 +1,74 @@
+#include <algorithm>
+#include <bit>
+#include <stdexcept>
+
+#include "utils/fast_fenwick_max.h"
+
+namespace cg::utils
+{
+    FastFenwickMax::FastFenwickMax(int n, int negInf)
+        : N(n),
+          neutral(negInf),
+          bit()
+    {
+        if (n < 0)
+        {
+            throw std::invalid_argument("FastFenwickMax: n must be non-negative");
+        }
+        bit.assign(static_cast<size_t>(N + 1), neutral);
+    }
+
+    void FastFenwickMax::build(std::span<const int> values)
+    {
+        if (static_cast<int>(values.size()) != N)
+        {
+            throw std::invalid_argument("FastFenwickMax::build: expected exactly N values");
+        }
+        bit[0] = neutral;
+        std::copy(values.begin(), values.end(), bit.begin() + 1);
+        // Each node pushes its (already complete) max into the one node that covers it next.
+        for (int i = 1; i <= N; ++i)
+        {
+            const int parent = i + lowbit(i);
+            if (parent <= N)
+            {
+                bit[static_cast<size_t>(parent)] = std::max(bit[static_cast<size_t>(parent)], bit[static_cast<size_t>(i)]);
+            }
+        }
+    }
+
+    void FastFenwickMax::prefixMaxInclusive(std::span<const int> indices, std::span<int> results) const
+    {
+        if (indices.size() != results.size())
+        {
+            throw std::invalid_argument("FastFenwickMax::prefixMaxInclusive: indices and results differ in size");
+        }
+
+        // The path of query j visits j with its lowest set bits cleared one at a time, i.e. read from the top it visits
+        // the prefixes of j's binary representation. Two queries share exactly the path nodes made of the bits above
+        // their highest differing bit, so pathMax keeps the previous query's running maxima top-down and a new query
+        // resumes from the last shared node instead of starting over.
+        int pathMax[std::numeric_limits<int>::digits + 1];
+        unsigned previous = 0;
+        for (size_t k = 0; k < indices.size(); ++k)
+        {
+            assert(indices[k] >= 0 && indices[k] < N);
+            const auto j = static_cast<unsigned>(indices[k] + 1);
+            const auto sharedShift = std::bit_width(previous ^ j);
+            auto depth = std::popcount(j >> sharedShift);
+            auto node = (j >> sharedShift) << sharedShift;
+            int res = depth > 0 ? pathMax[depth - 1] : neutral;
+            auto rest = j - node;
+            while (rest != 0)
+            {
+                const auto top = std::bit_floor(rest);
+                rest -= top;
+                node += top;
+                res = std::max(res, bit[static_cast<size_t>(node)]);
+                pathMax[depth++] = res;
+            }
+            results[k] = res;
+            previous = j;
+        }
+    }
+}
@@ -18,7 +18,7 @@
 #include "data_structures/distinct_interval_model.h"
 
 #include "utils/interval_model_utils.h"
-#include "utils/fenwick_max.h"
+#include "utils/fast_fenwick_max.h"
  
  namespace cg::interval_model_utils
  {
@@ -370,7 +370,7 @@
     // d[q] also in logarithmic time.
     std::vector<std::vector<cg::data_structures::Interval>> createLayers(const cg::data_structures::DistinctIntervalModel& intervalModel)
     {
-        cg::utils::FenwickMax depth(intervalModel.end, 0);
+        cg::utils::FastFenwickMax depth(intervalModel.end, 0);
         std::vector<std::vector<cg::data_structures::Interval>> layers;
         for (int q = static_cast<int>(intervalModel.end); q-- > 0; )
         {
@@ -0,0 +1,263 @@
+#include "utils/max_plus.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define CG_MAX_PLUS_X86 1
+#include <immintrin.h>
+#define CG_TARGET(isa) __attribute__((target(isa)))
+#else
+#define CG_MAX_PLUS_X86 0
+#endif
+
+namespace cg::utils
+{
+    namespace
+    {
+        // The reference semantics every kernel reproduces: saturating for the unsigned cell types, plain for int.
+        template <class T>
+        int addCells(T a, T b)
+        {
+            if constexpr (std::is_unsigned_v<T>)
+            {
+                return std::min<int>(a + b, std::numeric_limits<T>::max());
+            }
+            else
+            {
+                return a + b;
+            }
+        }
+
+        template <class T>
+        int maxPlusScalar(const T *a, const T *b, int begin, int count, int best)
+        {
+            for (int i = begin; i < count; ++i)
+            {
+                best = std::max(best, addCells(a[i], b[i]));
+            }
+            return best;
+        }
+
+        template <class T>
+        int lowestCell()
+        {
+            return std::is_unsigned_v<T> ? 0 : std::numeric_limits<int>::min();
+        }
+
+#if CG_MAX_PLUS_X86
+        // Each kernel reduces whole vectors into a running lane-wise max, stores the lanes, folds them here and
+        // finishes the tail with the scalar loop.
+        template <class T, std::size_t N>
+        int foldLanes(const T (&values)[N])
+        {
+            int best = lowestCell<T>();
+            for (const auto value : values)
+            {
+                best = std::max<int>(best, value);
+            }
+            return best;
+        }
+
+        template <class T>
+        CG_TARGET("sse4.1") int maxPlusSse41(const T *a, const T *b, int count)
+        {
+            constexpr int lanes = 16 / sizeof(T);
+            __m128i best = std::is_unsigned_v<T> ? _mm_setzero_si128() : _mm_set1_epi32(std::numeric_limits<int>::min());
+            int i = 0;
+            for (; i + lanes <= count; i += lanes)
+            {
+                const __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i *>(a + i));
+                const __m128i y = _mm_loadu_si128(reinterpret_cast<const __m128i *>(b + i));
+                if constexpr (std::is_same_v<T, std::uint8_t>)
+                {
+                    best = _mm_max_epu8(best, _mm_adds_epu8(x, y));
+                }
+                else if constexpr (std::is_same_v<T, std::uint16_t>)
+                {
+                    best = _mm_max_epu16(best, _mm_adds_epu16(x, y));
+                }
+                else
+                {
+                    best = _mm_max_epi32(best, _mm_add_epi32(x, y));
+                }
+            }
+            alignas(16) T values[lanes];
+            _mm_store_si128(reinterpret_cast<__m128i *>(values), best);
+            return maxPlusScalar(a, b, i, count, foldLanes(values));
+        }
+
+        template <class T>
+        CG_TARGET("avx2") int maxPlusAvx2(const T *a, const T *b, int count)
+        {
+            constexpr int lanes = 32 / sizeof(T);
+            __m256i best = std::is_unsigned_v<T> ? _mm256_setzero_si256() : _mm256_set1_epi32(std::numeric_limits<int>::min());
+            int i = 0;
+            for (; i + lanes <= count; i += lanes)
+            {
+                const __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(a + i));
+                const __m256i y = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(b + i));
+                if constexpr (std::is_same_v<T, std::uint8_t>)
+                {
+                    best = _mm256_max_epu8(best, _mm256_adds_epu8(x, y));
+                }
+                else if constexpr (std::is_same_v<T, std::uint16_t>)
+                {
+                    best = _mm256_max_epu16(best, _mm256_adds_epu16(x, y));
+                }
+                else
+                {
+                    best = _mm256_max_epi32(best, _mm256_add_epi32(x, y));
+                }
+            }
+            alignas(32) T values[lanes];
+            _mm256_store_si256(reinterpret_cast<__m256i *>(values), best);
+            return maxPlusScalar(a, b, i, count, foldLanes(values));
+        }
+
+        template <class T>
+        CG_TARGET("avx512f,avx512bw") int maxPlusAvx512(const T *a, const T *b, int count)
+        {
+            constexpr int lanes = 64 / sizeof(T);
+            __m512i best = std::is_unsigned_v<T> ? _mm512_setzero_si512() : _mm512_set1_epi32(std::numeric_limits<int>::min());
+            int i = 0;
+            for (; i + lanes <= count; i += lanes)
+            {
+                const __m512i x = _mm512_loadu_si512(a + i);
+                const __m512i y = _mm512_loadu_si512(b + i);
+                if constexpr (std::is_same_v<T, std::uint8_t>)
+                {
+                    best = _mm512_max_epu8(best, _mm512_adds_epu8(x, y));
+                }
+                else if constexpr (std::is_same_v<T, std::uint16_t>)
+                {
+                    best = _mm512_max_epu16(best, _mm512_adds_epu16(x, y));
+                }
+                else
+                {
+                    // Full mask rather than _mm512_max_epi32, whose undefined pass-through trips GCC 12 -Wmaybe-uninitialized.
+                    best = _mm512_mask_max_epi32(best, static_cast<__mmask16>(-1), best, _mm512_add_epi32(x, y));
+                }
+            }
+            alignas(64) T values[lanes];
+            _mm512_store_si512(values, best);
+            return maxPlusScalar(a, b, i, count, foldLanes(values));
+        }
+
+        SimdLevel detectSimdLevel()
+        {
+            __builtin_cpu_init();
+            if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw"))
+            {
+                return SimdLevel::Avx512;
+            }
+            if (__builtin_cpu_supports("avx2"))
+            {
+                return SimdLevel::Avx2;
+            }
+            if (__builtin_cpu_supports("sse4.1"))
+            {
+                return SimdLevel::Sse41;
+            }
+            return SimdLevel::Scalar;
+        }
+#else
+        SimdLevel detectSimdLevel()
+        {
+            return SimdLevel::Scalar;
+        }
+#endif
+
+        std::atomic<SimdLevel> &activeLevel()
+        {
+            static std::atomic<SimdLevel> level(supportedSimdLevel());
+            return level;
+        }
+
+        template <class T>
+        int maxPlusDispatch(const T *a, const T *b, int count)
+        {
+            assert(count >= 1);
+#if CG_MAX_PLUS_X86
+            switch (activeLevel().load(std::memory_order_relaxed))
+            {
+            case SimdLevel::Avx512:
+                return maxPlusAvx512(a, b, count);
+            case SimdLevel::Avx2:
+                return maxPlusAvx2(a, b, count);
+            case SimdLevel::Sse41:
+                return maxPlusSse41(a, b, count);
+            case SimdLevel::Scalar:
+                break;
+            }
+#endif
+            return maxPlusScalar(a, b, 0, count, lowestCell<T>());
+        }
+
+        // The vector pass finds the maximum; the first index reaching it is then a short scan that usually stops
+        // well before the end of the range.
+        template <class T>
+        MaxPlusResult argMaxPlusDispatch(const T *a, const T *b, int count)
+        {
+            const int best = maxPlusDispatch(a, b, count);
+            int index = 0;
+            while (addCells(a[index], b[index]) != best)
+            {
+                ++index;
+            }
+            return MaxPlusResult{best, index};
+        }
+    }
+
+    SimdLevel supportedSimdLevel()
+    {
+        static const SimdLevel level = detectSimdLevel();
+        return level;
+    }
+
+    SimdLevel activeSimdLevel()
+    {
+        return activeLevel().load(std::memory_order_relaxed);
+    }
+
+    SimdLevel setSimdLevel(SimdLevel level)
+    {
+        const auto clamped = std::min(level, supportedSimdLevel());
+        activeLevel().store(clamped, std::memory_order_relaxed);
+        return clamped;
+    }
+
+    int maxPlus(const std::uint8_t *a, const std::uint8_t *b, int count)
+    {
+        return maxPlusDispatch(a, b, count);
+    }
+
+    int maxPlus(const std::uint16_t *a, const std::uint16_t *b, int count)
+    {
+        return maxPlusDispatch(a, b, count);
+    }
+
+    int maxPlus(const int *a, const int *b, int count)
+    {
+        return maxPlusDispatch(a, b, count);
+    }
+
+    MaxPlusResult argMaxPlus(const std::uint8_t *a, const std::uint8_t *b, int count)
+    {
+        return argMaxPlusDispatch(a, b, count);
+    }
+
+    MaxPlusResult argMaxPlus(const std::uint16_t *a, const std::uint16_t *b, int count)
+    {
+        return argMaxPlusDispatch(a, b, count);
+    }
+
+    MaxPlusResult argMaxPlus(const int *a, const int *b, int count)
+    {
+        return argMaxPlusDispatch(a, b, count);
+    }
+}
@@ -2,387 +2,263 @@
 #include <ranges>
 #include <array>
 #include <limits>
-#include <queue>
 #include <stack>
 #include <algorithm>
 #include <optional>
 #include <format>
 #include <unordered_map>
+#include <unordered_set>
+#include <concepts>
+#include <iterator>
+#include <span>
+#include <stdexcept>
 
 #include "data_structures/graph.h"
+#include "data_structures/csr_graph.h"
 #include "utils/spinrad_prime.h"
 
 #include <iostream>
 
 namespace cg::utils
 {
-    class InitialLevel;
-
-    class Node
+    // The forests of one getDividedForests call. Every vertex gets exactly one node, so the nodes are a flat array
+    // indexed by vertex. The children of a node are the contiguous run of _bfsOrder that the BFS appended them to,
+    // skipping those that have since moved to another forest (their parent no longer points back). Initial levels
+    // are intrusive lists threaded through the nodes and live in a flat array too, and a forest is named by the
+    // index of its initial level. Nothing is allocated per node, and the whole structure goes away with the arena.
+    class ForestArena
     {
-        friend class InitialLevel;
-        int _vertexId;
-        int _childIdx;
-        int _levelId;
-        std::vector<Node*> _children;
-        Node* _parent;
-        Node* _initialLevelPrev;
-        Node* _initialLevelNext;
-
-        InitialLevel* _initialLevel;
-        bool _mark;
-        int _numDeletedChildren;
     public:
-        Node(int vertexId, int levelId, Node* parent);
-
-        Node* parent() const;
-
-        const std::vector<Node*> copy_children() const;
-
-        int numChildren();
-
-        void mark();
-
-        void unmark();
-
-        bool isMarked();
-
-        void setLevelId(int levelId);
-
-        int levelId();
+        static constexpr int None = -1;
 
-        void addToInitialLevel(InitialLevel* initialLevel);
-
-        InitialLevel* getInitialLevel() const;
-
-        [[nodiscard]] int vertexId() const;
-
-        void addChild(Node* child);
-
-        void deleteFromForest();
-    };
-
-    class InitialLevel
-    {
-        int _size = 0;
-        Node *head = nullptr;
-        int _levelId;
-    public:
-        explicit InitialLevel(int levelId);
-
-        int levelId() const;
-
-        int size() const noexcept;
-
-        void add(Node *n) noexcept;
-
-        void remove(Node *n) noexcept;
-
-        struct iterator
+    private:
+        struct Node
         {
-            Node *node;
-
-            Node *operator*() const noexcept;
-
-            iterator &operator++() noexcept;
-
-            bool operator!=(const iterator &o) const noexcept;
+            int parent = None;
+            int childBegin = 0;
+            int childEnd = 0;
+            int levelId = None;
+            int initialLevel = None;
+            int initialLevelPrevious = None;
+            int initialLevelNext = None;
         };
 
-        iterator begin() noexcept;
-
-        iterator end() noexcept;
-    };
-
-
-class Forest
-{
-    InitialLevel* _initialLevel;
-public:
-    Forest(InitialLevel* initialLevel, std::vector<Node*>& initialLevelNodes);
-
-    InitialLevel& initialLevel();
-    std::vector<int> getCorrespondingVertices();
-};
-
-    // ---------------------------------------------------------------------
-    // Implementation details
-    // ---------------------------------------------------------------------
-
-    // Node ----------------------------------------------------------------
-    Node::Node(int vertexId, int levelId, Node* parent) : _vertexId(vertexId), _levelId(levelId), _parent(parent), _initialLevel(nullptr), _initialLevelNext(nullptr), _initialLevelPrev(nullptr)
-    {
-
-    }
+        struct InitialLevel
+        {
+            int levelId;
+            int head = None;
+            int size = 0;
+        };
 
-    Node* Node::parent() const
-    {
-        return _parent;
-    }
+        std::vector<Node> _nodes;
+        std::vector<int> _bfsOrder;
+        std::vector<InitialLevel> _initialLevels;
 
-    const std::vector<Node*> Node::copy_children() const
-    {
-        std::vector<Node*> alive;
-        for(auto c : _children)
+    public:
+        explicit ForestArena(int numVertices) : _nodes(numVertices)
         {
-            if(c)
-            {
-                alive.push_back(c);
-            }
+            _bfsOrder.reserve(numVertices);
         }
-        return alive;
-    }
-
-    int Node::numChildren()
-    {
-        return _children.size() - _numDeletedChildren;
-    }
-
 
-    void Node::mark()
-    {
-        _mark = true;
-    }
-
-    void Node::unmark()
-    {
-        _mark = false;
-    }
-
-    bool Node::isMarked()
-    {
-        return _mark;
-    }
-
-    void Node::setLevelId(int levelId)
-    {
-        _levelId = levelId;
-    }
-
-    int Node::levelId()
-    {
-        return _levelId;
-    }
-
-    void Node::addToInitialLevel(InitialLevel* initialLevel)
-    {
-        if(_parent != nullptr)
+        // Creates vertex's node, appending it to the BFS order; the caller records it as a child of 'parent'.
+        void addNode(int vertex, int levelId, int parent)
         {
-            throw std::runtime_error("Cannot set initial level, this node has a parent.");
+            _nodes[vertex].parent = parent;
+            _nodes[vertex].levelId = levelId;
+            _bfsOrder.push_back(vertex);
         }
-        _initialLevel = initialLevel;
-        _initialLevel->add(this);
-    }
 
-    InitialLevel* Node::getInitialLevel() const
-    {
-        return _initialLevel;
-    }
-
-    int Node::vertexId() const
-    {
-        return _vertexId;
-    }
-
-    void Node::addChild(Node* child)
-    {
-        child->_childIdx = _children.size();
-        _children.push_back(child);
-    }
+        [[nodiscard]] int bfsOrderSize() const { return static_cast<int>(_bfsOrder.size()); }
+        [[nodiscard]] int bfsOrderAt(int position) const { return _bfsOrder[position]; }
 
-    void Node::deleteFromForest()
-    {
-        if(_parent)
-        {
-            _parent->_children[_childIdx] = nullptr;
-            ++_parent->_numDeletedChildren;
-            _parent = nullptr;
-
-        }
-        else
+        void setChildren(int vertex, int childBegin, int childEnd)
         {
-            if(_initialLevel == nullptr)
-            {
-                throw std::runtime_error("This node doesn't have a parent, so its initial level should be set, but isn't.");
-            }
-            _initialLevel->remove(this);
+            _nodes[vertex].childBegin = childBegin;
+            _nodes[vertex].childEnd = childEnd;
         }
-    }
-
-    // InitialLevel ---------------------------------------------------------
-    InitialLevel::InitialLevel(int levelId) : _levelId(levelId)
-    {
-
-    }
-
-    int InitialLevel::levelId() const
-    {
-        return _levelId;
-    }
 
-    int InitialLevel::size() const noexcept
-    {
-        return _size;
-    }
+        [[nodiscard]] int parent(int vertex) const { return _nodes[vertex].parent; }
+        [[nodiscard]] int levelId(int vertex) const { return _nodes[vertex].levelId; }
+        void setLevelId(int vertex, int levelId) { _nodes[vertex].levelId = levelId; }
 
-    void InitialLevel::add(Node *n) noexcept
-    {
-        n->_initialLevelPrev = nullptr;
-        n->_initialLevelNext = head;
+        // The initial level 'vertex' was last added to, or None for a node that has always had a parent.
+        [[nodiscard]] int initialLevelOf(int vertex) const { return _nodes[vertex].initialLevel; }
 
-        if (head)
+        [[nodiscard]] int addInitialLevel(int levelId)
         {
-            head->_initialLevelPrev = n;
+            _initialLevels.push_back(InitialLevel{levelId});
+            return static_cast<int>(_initialLevels.size()) - 1;
         }
 
-        head = n;
-        ++_size;
-    }
+        [[nodiscard]] int initialLevelId(int initialLevel) const { return _initialLevels[initialLevel].levelId; }
+        [[nodiscard]] int initialLevelSize(int initialLevel) const { return _initialLevels[initialLevel].size; }
 
-    void InitialLevel::remove(Node *n) noexcept
-    {
-        if (n->_initialLevelPrev)
-        {
-            n->_initialLevelPrev->_initialLevelNext = n->_initialLevelNext;
-        }
-        else
+        // Calls f(vertex) for the members of an initial level, most recently added first.
+        template <class F>
+        void forEachInInitialLevel(int initialLevel, F &&f) const
         {
-            head = n->_initialLevelNext;
+            for (auto v = _initialLevels[initialLevel].head; v != None; v = _nodes[v].initialLevelNext)
+            {
+                f(v);
+            }
         }
 
-        if (n->_initialLevelNext)
+        void addToInitialLevel(int vertex, int initialLevel)
         {
-            n->_initialLevelNext->_initialLevelPrev = n->_initialLevelPrev;
+            auto &node = _nodes[vertex];
+            if (node.parent != None)
+            {
+                throw std::runtime_error("Cannot set initial level, this node has a parent.");
+            }
+            auto &level = _initialLevels[initialLevel];
+            node.initialLevel = initialLevel;
+            node.initialLevelPrevious = None;
+            node.initialLevelNext = level.head;
+            if (level.head != None)
+            {
+                _nodes[level.head].initialLevelPrevious = vertex;
+            }
+            level.head = vertex;
+            ++level.size;
         }
 
-        n->_initialLevelPrev = nullptr;
-        n->_initialLevelNext = nullptr;
-        --_size;
-    }
-
-    Node *InitialLevel::iterator::operator*() const noexcept
-    {
-        return node;
-    }
-
-    InitialLevel::iterator &InitialLevel::iterator::operator++() noexcept
-    {
-        node = node->_initialLevelNext;
-        return *this;
-    }
-
-    bool InitialLevel::iterator::operator!=(const iterator &o) const noexcept
-    {
-        return node != o.node;
-    }
-
-    InitialLevel::iterator InitialLevel::begin() noexcept
-    {
-        return iterator{head};
-    }
-
-    InitialLevel::iterator InitialLevel::end() noexcept
-    {
-        return iterator{nullptr};
-    }
-
-    // Forest ---------------------------------------------------------------
-    Forest::Forest(InitialLevel* initialLevel, std::vector<Node*>& initialLevelNodes) : _initialLevel(initialLevel)
-    {
-        for(auto n : initialLevelNodes)
+        void deleteFromForest(int vertex)
         {
-            n->addToInitialLevel(_initialLevel);
+            auto &node = _nodes[vertex];
+            if (node.parent != None)
+            {
+                node.parent = None;
+                return;
+            }
+            if (node.initialLevel == None)
+            {
+                throw std::runtime_error("This node doesn't have a parent, so its initial level should be set, but isn't.");
+            }
+            auto &level = _initialLevels[node.initialLevel];
+            if (node.initialLevelPrevious != None)
+            {
+                _nodes[node.initialLevelPrevious].initialLevelNext = node.initialLevelNext;
+            }
+            else
+            {
+                level.head = node.initialLevelNext;
+            }
+            if (node.initialLevelNext != None)
+            {
+                _nodes[node.initialLevelNext].initialLevelPrevious = node.initialLevelPrevious;
+            }
+            node.initialLevelPrevious = None;
+            node.initialLevelNext = None;
+            --level.size;
         }
-    }
 
-    InitialLevel& Forest::initialLevel()
-    {
-        return *_initialLevel;
-    }
-
-    std::vector<int> Forest::getCorrespondingVertices()
-    {
-        std::queue<Node*> pending;
-        for(auto n : *_initialLevel)
+        // The root of the tree holding 'vertex'.
+        [[nodiscard]] int root(int vertex) const
         {
-            pending.push(n);
+            while (_nodes[vertex].parent != None)
+            {
+                vertex = _nodes[vertex].parent;
+            }
+            return vertex;
         }
-        std::vector<Node*> allNodes;
 
-        while(!pending.empty())
+        // Appends the vertices of a forest: its initial level, then the rest of its trees in BFS order.
+        void appendForestVertices(int initialLevel, std::vector<int> &vertices) const
         {
-            auto n = pending.front();
-            allNodes.push_back(n);
-            pending.pop();
-            for(auto child : n->copy_children())
+            auto next = vertices.size();
+            forEachInInitialLevel(initialLevel, [&](int v) { vertices.push_back(v); });
+            for (; next < vertices.size(); ++next)
             {
-                if(!child->isMarked())
+                const auto v = vertices[next];
+                for (auto c = _nodes[v].childBegin; c < _nodes[v].childEnd; ++c)
                 {
-                    pending.push(child);
-                    child->mark();
+                    if (_nodes[_bfsOrder[c]].parent == v)
+                    {
+                        vertices.push_back(_bfsOrder[c]);
+                    }
                 }
             }
         }
+    };
 
-        std::vector<int> result;
-        for(auto n : allNodes)
-        {
-            n->unmark();
-            result.push_back(n->vertexId());
-        }
-        return result;
-    }
-
+    // CsrGraph keeps every neighbourhood sorted, so set operations on two of them are a linear merge.
+    template <class TGraph>
+    constexpr bool hasSortedNeighbours = std::same_as<TGraph, cg::data_structures::CsrGraph>;
 
     // return all neighbours of 'a' except 'b' and except those also in neighbours(b)
     // i.e., N(a) - N(b) - {b}
-    std::vector<cg::data_structures::Graph::Vertex> neighbours_except(
-        const cg::data_structures::Graph &g,
-        const cg::data_structures::Graph::Vertex &a,
-        const cg::data_structures::Graph::Vertex &b)
+    template <cg::data_structures::AdjacencyGraph TGraph>
+    std::vector<typename TGraph::Vertex> neighbours_except(
+        const TGraph &g,
+        const typename TGraph::Vertex &a,
+        const typename TGraph::Vertex &b)
     {
         const auto &Na = g.neighbours(a);
         const auto &Nb = g.neighbours(b);
 
-        std::vector<cg::data_structures::Graph::Vertex> result;
+        std::vector<typename TGraph::Vertex> result;
         result.reserve(Na.size());
 
-        for (auto v : Na)
+        if constexpr (hasSortedNeighbours<TGraph>)
+        {
+            std::set_difference(Na.begin(), Na.end(), Nb.begin(), Nb.end(), std::back_inserter(result));
+            std::erase(result, b);
+        }
+        else
         {
-            if (v != b && Nb.find(v) == Nb.end())
+            for (auto v : Na)
             {
-                result.push_back(v);
+                if (v != b && !g.hasEdge(b, v))
+                {
+                    result.push_back(v);
+                }
             }
         }
 
         return result;
     }
 
-    std::vector<cg::data_structures::Graph::Vertex> neighbours_intersection(
-        const cg::data_structures::Graph::Neighbours &Na,
-        const cg::data_structures::Graph::Neighbours &Nb)
+    // N(a) intersected with N(b)
+    template <cg::data_structures::AdjacencyGraph TGraph>
+    std::vector<typename TGraph::Vertex> neighbours_intersection(
+        const TGraph &g,
+        const typename TGraph::Vertex &a,
+        const typename TGraph::Vertex &b)
     {
-        std::vector<cg::data_structures::Graph::Vertex> result;
+        const auto &Na = g.neighbours(a);
+        const auto &Nb = g.neighbours(b);
+
+        std::vector<typename TGraph::Vertex> result;
         result.reserve(std::min(Na.size(), Nb.size()));
 
-        for (auto v : Na)
+        if constexpr (hasSortedNeighbours<TGraph>)
+        {
+            std::set_intersection(Na.begin(), Na.end(), Nb.begin(), Nb.end(), std::back_inserter(result));
+        }
+        else
         {
-            if (Nb.find(v) != Nb.end())
+            for (auto v : Na)
             {
-                result.push_back(v);
+                if (g.hasEdge(b, v))
+                {
+                    result.push_back(v);
+                }
             }
         }
 
         return result;
     }
 
-    std::tuple<std::vector<Forest>, std::vector<Node*>, int> createForests(const cg::data_structures::Graph& g, const cg::data_structures::Graph::Vertex& a, const cg::data_structures::Graph::Vertex& b)
+    // Builds the five BFS forests rooted at N(a) - N(b), N(b) - N(a), N(a) & N(b), {a} and {b} in 'arena' and
+    // returns the initial levels of the non-empty ones and the next unused level id.
+    template <cg::data_structures::AdjacencyGraph TGraph>
+    std::tuple<std::vector<int>, int> createForests(const TGraph& g, const typename TGraph::Vertex& a, const typename TGraph::Vertex& b, ForestArena& arena)
     {
         auto nextLevelId = 0; // This counter is globally unique, across all levels in all forests.
 
         auto aForestRoots = neighbours_except(g, a, b);
         auto bForestRoots = neighbours_except(g, b, a);
-        auto intersectForestRoots = neighbours_intersection(g.neighbours(a), g.neighbours(b));
+        auto intersectForestRoots = neighbours_intersection(g, a, b);
 
         std::array<std::vector<int>, 5> rootGroups{{
             aForestRoots,
@@ -393,9 +269,8 @@ public:
         }};
 
 
-        std::vector<Forest> forests;
+        std::vector<int> forests;
         std::vector<bool> isMarked(g.numVertices(), false);
-        std::vector<Node*> vertexToNode(g.numVertices(), nullptr);
 
         for(const auto& roots : rootGroups)
         {
@@ -411,161 +286,363 @@ public:
             {
                 continue;
             }
-            auto forestId = forests.size();
 
-            std::vector<Node*> currentLevel;
-            currentLevel.reserve(roots.size());
+            auto levelBegin = arena.bfsOrderSize();
             for (const auto& r : roots)
             {
-                auto v = new Node(r, nextLevelId, nullptr);
-                vertexToNode[r] = v;
-                currentLevel.emplace_back(v);
+                arena.addNode(r, nextLevelId, ForestArena::None);
+            }
+            auto initialLevel = arena.addInitialLevel(nextLevelId);
+            for (const auto& r : roots)
+            {
+                arena.addToInitialLevel(r, initialLevel);
             }
-            
-            auto initialLevel = new InitialLevel(nextLevelId);
-            Forest f(initialLevel, currentLevel);
             ++nextLevelId;
-            forests.push_back(f); 
+            forests.push_back(initialLevel);
 
-            // Perform an ordinary BFS from the roots, constructing the resultant forest.
-            while(!currentLevel.empty())
+            // Perform an ordinary BFS from the roots, constructing the resultant forest. Each level is a run of the
+            // arena's BFS order, and the children of a node are appended together, so they form a run as well.
+            auto levelEnd = arena.bfsOrderSize();
+            while(levelBegin != levelEnd)
             {
-                std::vector<Node*> nextLevel;
-                for(auto v : currentLevel)
+                for(auto i = levelBegin; i < levelEnd; ++i)
                 {
-                    auto neighbours = g.neighbours(v->vertexId());
-                    for(auto w : neighbours)
+                    auto v = arena.bfsOrderAt(i);
+                    auto childBegin = arena.bfsOrderSize();
+                    for(auto w : g.neighbours(v))
                     {
                         if(!isMarked[w])
                         {
-                            auto child = new Node(w, nextLevelId, v);
-                            vertexToNode[w] = child;
+                            arena.addNode(w, nextLevelId, v);
                             isMarked[w] = true;
-                            v->addChild(child);
-                            nextLevel.push_back(child);
                         }
                     }
+                    arena.setChildren(v, childBegin, arena.bfsOrderSize());
                 }
                 ++nextLevelId;
-                currentLevel = std::move(nextLevel);
+                levelBegin = levelEnd;
+                levelEnd = arena.bfsOrderSize();
             }
         }    
-        return std::tuple{forests,vertexToNode, nextLevelId};
+        return std::tuple{std::move(forests), nextLevelId};
     }
 
-    void addIfEligible(std::vector<int>& vertexIdToLastInitialLevelSize, std::queue<Node*>& eligibleNodes, Node* n, int initialLevelSize)
+    void addIfEligible(std::vector<int>& vertexIdToLastInitialLevelSize, std::vector<int>& eligibleNodes, int vertexId, int initialLevelSize)
     {
-        auto vertexId = n->vertexId();
         auto previousSize = vertexIdToLastInitialLevelSize[vertexId];
         if (initialLevelSize <= previousSize / 2)
         {
-            eligibleNodes.push(n);
+            eligibleNodes.push_back(vertexId);
             vertexIdToLastInitialLevelSize[vertexId] = initialLevelSize;
         }
     }
 
-    void markCrossEdgeTargets(const cg::data_structures::Graph &g, std::vector<Node*>& vertexToNode, Node *source, std::vector<Node*>& crossEdgeTargets)
+    template <cg::data_structures::AdjacencyGraph TGraph>
+    void markCrossEdgeTargets(const TGraph &g, const ForestArena& arena, int xVertex, std::vector<int>& crossEdgeTargets)
     {
-        auto xVertex = source->vertexId();
         const auto& xNeighbours = g.neighbours(xVertex);
         for (auto y : xNeighbours)
         {
-            auto yNode = vertexToNode[y];
             // Perhaps there is a constant time way to determine if other nodes are in the same forest as 'source'
             // E.g. Perhaps by maintaining a list of edges per node somehow, and updating it as we move the node to a new forest.
             // Spinrad claims this entire step can be done in O(degree(x)) for a vertex x (which would imply a constant time test for whether two nodes are in the same forest), but doesn't explain how.
             // It seems the problem to be solved is equivalent to split-find (so could be done in O(inverse-ackerman(n))), but 
             // perhaps I'm missing something.
             // Since I don't mind the exact time complexity for now, I'll leave this (perhaps, if I get interested in much larger graphs I'll revisit it)
-            auto n = yNode;
-            while (n->parent() != nullptr)
-            {
-                n = n->parent();
-            }
-            auto sourceInitialLevel = source->getInitialLevel(); // This must exist, because 'source' must always be part of an initial level.
-            auto sameForestAsSource = sourceInitialLevel->levelId() == n->levelId();
+            auto n = arena.root(y);
+            auto sourceInitialLevel = arena.initialLevelOf(xVertex); // This must exist, because 'source' must always be part of an initial level.
+            auto sameForestAsSource = arena.initialLevelId(sourceInitialLevel) == arena.levelId(n);
             if (!sameForestAsSource)
             {
-                crossEdgeTargets.push_back(yNode);
+                crossEdgeTargets.push_back(y);
             }
         }
     }
 
-    std::vector<Forest> SpinradPrime::getDividedForests(const cg::data_structures::Graph& g, const cg::data_structures::Graph::Vertex& a, const cg::data_structures::Graph::Vertex& b)
+    template <cg::data_structures::AdjacencyGraph TGraph>
+    SpinradPrime::DividedForests SpinradPrime::getDividedForests(const TGraph& g, const typename TGraph::Vertex& a, const typename TGraph::Vertex& b)
     {
-        auto [allForests, vertexToNode, nextLevelId] = createForests(g, a, b);
+        constexpr auto None = ForestArena::None;
+        ForestArena arena(g.numVertices());
+        auto [allForests, nextLevelId] = createForests(g, a, b, arena);
 
-        std::vector<std::vector<Node*>> levelIdToExtractedNodes(g.numVertices() * 2);
+        // The nodes extracted from each level in one round, as linked lists (head, tail and size per level id, next
+        // per vertex) in the order they were found. A vertex is a cross-edge target at most once per round.
+        std::vector<int> levelIdToExtractedHead(g.numVertices() * 2, None);
+        std::vector<int> levelIdToExtractedTail(g.numVertices() * 2, None);
+        std::vector<int> levelIdToExtractedSize(g.numVertices() * 2, 0);
+        std::vector<int> nextExtracted(g.numVertices(), None);
         std::vector<int> seenLevelIds;
 
         std::vector<int> vertexIdToLastInitialLevelSize(g.numVertices(), std::numeric_limits<int>::max());        
-        std::queue<Node*> eligibleNodes; 
-        for(auto& f : allForests)
+        std::vector<int> eligibleNodes; // A FIFO queue, read from 'nextEligible' on.
+        for(auto f : allForests)
         {
-            for(auto n : f.initialLevel()) 
+            arena.forEachInInitialLevel(f, [&](int n)
             {
-                eligibleNodes.push(n);
-            }
+                eligibleNodes.push_back(n);
+            });
         }
-        std::vector<Node*> crossEdgeTargets;
-        while(!eligibleNodes.empty())
+        std::vector<int> crossEdgeTargets;
+        for(std::size_t nextEligible = 0; nextEligible < eligibleNodes.size(); ++nextEligible)
         {
-            auto xNode = eligibleNodes.front();
-            eligibleNodes.pop();
-            markCrossEdgeTargets(g, vertexToNode, xNode, crossEdgeTargets);
+            auto xNode = eligibleNodes[nextEligible];
+            markCrossEdgeTargets(g, arena, xNode, crossEdgeTargets);
             for (auto yNode : crossEdgeTargets)
             {
                 // We're grouping nodes by the level they come from here using the globally unique levelIds, so that we can create new initial levels afterward,
-                auto oldLevelId = yNode->levelId();
-                auto& thisLevelNodes = levelIdToExtractedNodes[oldLevelId];
-                if(thisLevelNodes.empty())
+                auto oldLevelId = arena.levelId(yNode);
+                if (oldLevelId >= static_cast<int>(levelIdToExtractedHead.size()))
+                {
+                    levelIdToExtractedHead.resize(2 * oldLevelId + 1, None);
+                    levelIdToExtractedTail.resize(2 * oldLevelId + 1, None);
+                    levelIdToExtractedSize.resize(2 * oldLevelId + 1, 0);
+                }
+                if(levelIdToExtractedSize[oldLevelId] == 0)
                 {
                     seenLevelIds.push_back(oldLevelId);
+                    levelIdToExtractedHead[oldLevelId] = yNode;
                 }
-                thisLevelNodes.push_back(yNode);
+                else
+                {
+                    nextExtracted[levelIdToExtractedTail[oldLevelId]] = yNode;
+                }
+                levelIdToExtractedTail[oldLevelId] = yNode;
+                nextExtracted[yNode] = None;
+                ++levelIdToExtractedSize[oldLevelId];
             }
             crossEdgeTargets.clear();
 
             // Create the new forests
             for(auto levelId : seenLevelIds)
             {                
-                auto& newInitialLevelNodes = levelIdToExtractedNodes[levelId];
-                auto firstNode = newInitialLevelNodes[0];
-                auto oldInitialLevel = firstNode->getInitialLevel();
-                if (oldInitialLevel == nullptr || newInitialLevelNodes.size() < oldInitialLevel->size())
+                auto firstNode = levelIdToExtractedHead[levelId];
+                auto oldInitialLevel = arena.initialLevelOf(firstNode);
+                if (oldInitialLevel == None || levelIdToExtractedSize[levelId] < arena.initialLevelSize(oldInitialLevel))
                 {
-                    for (auto n : newInitialLevelNodes)
+                    for (auto n = firstNode; n != None; n = nextExtracted[n])
                     {
-                        n->deleteFromForest();
-                        n->setLevelId(nextLevelId);
+                        arena.deleteFromForest(n);
+                        arena.setLevelId(n, nextLevelId);
                     }
-                    auto newInitialLevel = new InitialLevel(nextLevelId);
-                    Forest newForest(newInitialLevel, newInitialLevelNodes);
-                    for (auto n : *newInitialLevel)
+                    auto newInitialLevel = arena.addInitialLevel(nextLevelId);
+                    for (auto n = firstNode; n != None; n = nextExtracted[n])
                     {
-                        addIfEligible(vertexIdToLastInitialLevelSize, eligibleNodes, n, newInitialLevel->size());
+                        arena.addToInitialLevel(n, newInitialLevel);
                     }
-                    if (oldInitialLevel != nullptr)
+                    arena.forEachInInitialLevel(newInitialLevel, [&](int n)
                     {
-                        for (auto n : *oldInitialLevel)
+                        addIfEligible(vertexIdToLastInitialLevelSize, eligibleNodes, n, arena.initialLevelSize(newInitialLevel));
+                    });
+                    if (oldInitialLevel != None)
+                    {
+                        arena.forEachInInitialLevel(oldInitialLevel, [&](int n)
                         {
-                            addIfEligible(vertexIdToLastInitialLevelSize, eligibleNodes, n, oldInitialLevel->size());
-                        }
+                            addIfEligible(vertexIdToLastInitialLevelSize, eligibleNodes, n, arena.initialLevelSize(oldInitialLevel));
+                        });
                     }
                     ++nextLevelId;
-                    allForests.push_back(std::move(newForest));
+                    allForests.push_back(newInitialLevel);
                 }
-                newInitialLevelNodes.clear();
+                levelIdToExtractedSize[levelId] = 0;
             }
             seenLevelIds.clear();
-        }  
-        return allForests;
+        }
+
+        DividedForests result;
+        result.vertices.reserve(g.numVertices());
+        result.forestBegin.reserve(allForests.size() + 1);
+        for (auto f : allForests)
+        {
+            result.forestBegin.push_back(static_cast<int>(result.vertices.size()));
+            arena.appendForestVertices(f, result.vertices);
+        }
+        result.forestBegin.push_back(static_cast<int>(result.vertices.size()));
+        return result;
+    }
+
+    // Whether (V \ side, side) is a split of g: both parts have at least two vertices and every vertex outside 'side'
+    // with a neighbour inside it has the same neighbours inside it.
+    template <cg::data_structures::AdjacencyGraph TGraph>
+    bool isSplit(const TGraph& g, std::span<const int> side)
+    {
+        if (side.size() < 2 || g.numVertices() - static_cast<int>(side.size()) < 2)
+        {
+            return false;
+        }
+        std::vector<int> inSide(g.numVertices(), 0);
+        for (auto v : side)
+        {
+            inSide[v] = 1;
+        }
+        std::vector<int> frontier;
+        for (int v = 0; v < g.numVertices(); ++v)
+        {
+            if (inSide[v])
+            {
+                continue;
+            }
+            std::vector<int> trace;
+            for (auto w : g.neighbours(v))
+            {
+                if (inSide[w])
+                {
+                    trace.push_back(w);
+                }
+            }
+            if (trace.empty())
+            {
+                continue;
+            }
+            std::ranges::sort(trace);
+            if (frontier.empty())
+            {
+                frontier = std::move(trace);
+            }
+            else if (trace != frontier)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // An exact search for a split (A, B) of a connected graph with x and y in A, used when the forests do not give
+    // one. Guess a vertex b of B with a neighbour in A. Then u in A is on A's frontier exactly when p(u) = (u ~ b), and
+    // every frontier vertex of A has B's frontier as its neighbours in B. Grow the smallest candidate A from {x, y}: a
+    // vertex without p takes all its neighbours into A. The first vertex a with p to be reached fixes
+    // q(w) = (w == b or w ~ a), after which a vertex u with p takes into A its neighbours without q and its
+    // non-neighbours with q. The result is a split exactly when b stays out and at least two vertices are left, and
+    // every split with x and y in A contains it for the right guess. Non-neighbours are found by scanning the still
+    // unreached q-vertices: a scanned vertex is either reached and dropped, or a neighbour of u. So each guess costs
+    // O(n + m) and the search O(n (n + m)), the same bound as growing the forests.
+    template <cg::data_structures::AdjacencyGraph TGraph>
+    std::optional<std::tuple<std::vector<int>,std::vector<int>>> findSplitByClosure(const TGraph& g, int x, int y)
+    {
+        const auto n = g.numVertices();
+        std::vector<char> isP(n, 0);
+        std::vector<char> isQ(n, 0);
+        std::vector<char> isNeighbour(n, 0);
+        std::vector<char> inA(n, 0);
+        std::vector<int> reached;
+        std::vector<int> pending;
+        std::vector<int> unreachedQ;
+        for (int b = 0; b < n; ++b)
+        {
+            if (b == x || b == y)
+            {
+                continue;
+            }
+            for (auto v : g.neighbours(b))
+            {
+                isP[v] = 1;
+            }
+            int a = -1;
+            const auto reach = [&](int v)
+            {
+                if (inA[v])
+                {
+                    return;
+                }
+                inA[v] = 1;
+                reached.push_back(v);
+                pending.push_back(v);
+                if (isP[v] && a < 0)
+                {
+                    a = v;
+                    isQ[b] = 1;
+                    unreachedQ.push_back(b);
+                    for (auto w : g.neighbours(a))
+                    {
+                        isQ[w] = 1;
+                        unreachedQ.push_back(w);
+                    }
+                }
+            };
+            reach(x);
+            reach(y);
+            while (!pending.empty() && !inA[b])
+            {
+                const auto u = pending.back();
+                pending.pop_back();
+                if (!isP[u])
+                {
+                    for (auto w : g.neighbours(u))
+                    {
+                        reach(w);
+                    }
+                    continue;
+                }
+                for (auto w : g.neighbours(u))
+                {
+                    isNeighbour[w] = 1;
+                    if (!isQ[w])
+                    {
+                        reach(w);
+                    }
+                }
+                std::erase_if(unreachedQ, [&](int w)
+                {
+                    if (inA[w])
+                    {
+                        return true;
+                    }
+                    if (!isNeighbour[w])
+                    {
+                        reach(w);
+                        return true;
+                    }
+                    return false;
+                });
+                for (auto w : g.neighbours(u))
+                {
+                    isNeighbour[w] = 0;
+                }
+            }
+
+            std::optional<std::tuple<std::vector<int>,std::vector<int>>> split;
+            if (!inA[b] && n - static_cast<int>(reached.size()) >= 2)
+            {
+                std::vector<int> v1;
+                std::vector<int> v2;
+                for (int v = 0; v < n; ++v)
+                {
+                    (inA[v] ? v1 : v2).push_back(v);
+                }
+                split = std::tuple{std::move(v1), std::move(v2)};
+            }
+            for (auto v : reached)
+            {
+                inA[v] = 0;
+            }
+            reached.clear();
+            pending.clear();
+            if (a >= 0)
+            {
+                for (auto w : g.neighbours(a))
+                {
+                    isQ[w] = 0;
+                }
+                isQ[b] = 0;
+            }
+            unreachedQ.clear();
+            for (auto v : g.neighbours(b))
+            {
+                isP[v] = 0;
+            }
+            if (split)
+            {
+                return split;
+            }
+        }
+        return std::nullopt;
     }
 
-    std::optional<std::tuple<std::vector<int>,std::vector<int>>> getSplitIfNotConnected(const cg::data_structures::Graph& g)
+    template <cg::data_structures::AdjacencyGraph TGraph>
+    std::optional<std::tuple<std::vector<int>,std::vector<int>>> getSplitIfNotConnected(const TGraph& g)
     {
         std::vector<bool> visited(g.numVertices(), false);
-        std::stack<int> pending;
+        std::stack<int, std::vector<int>> pending;
         pending.push(0);
         while(!pending.empty())
         {
@@ -599,7 +676,8 @@ public:
         return std::nullopt;
     }
 
-    std::optional<std::tuple<std::vector<int>,std::vector<int>>> SpinradPrime::trySplit(const cg::data_structures::Graph& g)
+    template <cg::data_structures::AdjacencyGraph TGraph>
+    std::optional<std::tuple<std::vector<int>,std::vector<int>>> SpinradPrime::trySplit(const TGraph& g)
     {
         if(g.numVertices() < 4)
         {
@@ -619,18 +697,18 @@ public:
 
         for(auto [x, y] : vertexPairs)
         {
-            auto allForests = getDividedForests(g, x, y);
-
-            std::vector<std::vector<int>> forestVertices;
+            auto forests = getDividedForests(g, x, y);
+            auto numForests = static_cast<int>(forests.forestBegin.size()) - 1;
+            auto forestVertices = [&](int i)
+            {
+                return std::span(forests.vertices).subspan(forests.forestBegin[i], forests.forestBegin[i + 1] - forests.forestBegin[i]);
+            };
 
             int maxForestIndex = 0;
             int maxForestSize = 0;
-            for (int i = 0; i < allForests.size(); ++i)
+            for (int i = 0; i < numForests; ++i)
             {
-                auto f = allForests[i];
-                auto vertices = f.getCorrespondingVertices();
-                forestVertices.push_back(vertices);
-
+                auto vertices = forestVertices(i);
                 if (vertices.size() > maxForestSize)
                 {
                     maxForestIndex = i;
@@ -640,11 +718,21 @@ public:
 
             if (maxForestSize > 1)
             {
-                auto v2 = forestVertices[maxForestIndex];
+                auto largest = forestVertices(maxForestIndex);
+                if (!isSplit(g, largest))
+                {
+                    // The largest forest is not always a split side. Settle this pair exactly.
+                    if (auto split = findSplitByClosure(g, x, y))
+                    {
+                        return split;
+                    }
+                    continue;
+                }
+                std::vector<int> v2(largest.begin(), largest.end());
                 std::vector<int> v1;
-                for (int i = 0; i < allForests.size(); ++i)
+                for (int i = 0; i < numForests; ++i)
                 {
-                    auto v = forestVertices[i];
+                    auto v = forestVertices(i);
                     if (i != maxForestIndex)
                     {
                         v1.insert(v1.end(), v.begin(), v.end());
@@ -656,7 +744,8 @@ public:
         return std::nullopt;
     }
 
-    void SpinradPrime::verifySplit(const cg::data_structures::Graph& g, std::vector<int>& v1, std::vector<int>& v2)
+    template <cg::data_structures::AdjacencyGraph TGraph>
+    void SpinradPrime::verifySplit(const TGraph& g, std::vector<int>& v1, std::vector<int>& v2)
     {
         if (v1.size() < 2)
         {
@@ -707,4 +796,9 @@ public:
             }
         }
     }
+
+    template std::optional<std::tuple<std::vector<int>, std::vector<int>>> SpinradPrime::trySplit(const cg::data_structures::Graph& graph);
+    template std::optional<std::tuple<std::vector<int>, std::vector<int>>> SpinradPrime::trySplit(const cg::data_structures::CsrGraph& graph);
+    template void SpinradPrime::verifySplit(const cg::data_structures::Graph& graph, std::vector<int>& v1, std::vector<int>& v2);
+    template void SpinradPrime::verifySplit(const cg::data_structures::CsrGraph& graph, std::vector<int>& v1, std::vector<int>& v2);
 }
\ No newline at end of file
@@ -0,0 +1,349 @@
+#include "utils/split_decomposition.h"
+#include "utils/spinrad_prime.h"
+#include "utils/thread_pool.h"
+
+#include <algorithm>
+#include <numeric>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace cg::utils
+{
+    namespace
+    {
+        using cg::data_structures::CsrGraph;
+
+        // A graph still to be decomposed, local vertex i being labels[i]. The marker of a half created in the
+        // current round is its last vertex and is labelled PendingMarker until the round is committed.
+        struct PendingGraph
+        {
+            static constexpr int PendingMarker = -1;
+
+            std::vector<int> labels;
+            CsrGraph graph;
+        };
+
+        // What decomposing one pending graph gave: a node of the tree, or the two halves of a split.
+        struct Outcome
+        {
+            std::optional<SplitTreeNode> node;
+            std::vector<PendingGraph> halves;
+        };
+
+        [[nodiscard]] bool isConnected(const CsrGraph &graph)
+        {
+            if (graph.numVertices() == 0)
+            {
+                return true;
+            }
+            std::vector<bool> visited(graph.numVertices(), false);
+            std::vector<int> pending{0};
+            visited[0] = true;
+            auto numVisited = 1;
+            while (!pending.empty())
+            {
+                const auto v = pending.back();
+                pending.pop_back();
+                for (auto w : graph.neighbours(v))
+                {
+                    if (!visited[w])
+                    {
+                        visited[w] = true;
+                        ++numVisited;
+                        pending.push_back(w);
+                    }
+                }
+            }
+            return numVisited == graph.numVertices();
+        }
+
+        // Clique or Star (with its local centre), or nothing for any other graph.
+        [[nodiscard]] std::optional<std::pair<SplitNodeType, int>> degenerateType(const CsrGraph &graph)
+        {
+            const auto n = graph.numVertices();
+            auto numFull = 0;
+            auto numLeaves = 0;
+            auto centre = SplitTreeNode::NoVertex;
+            for (auto v = 0; v < n; ++v)
+            {
+                const auto degree = graph.degree(v);
+                if (degree == n - 1)
+                {
+                    ++numFull;
+                    centre = v;
+                }
+                else if (degree == 1)
+                {
+                    ++numLeaves;
+                }
+            }
+            if (numFull == n)
+            {
+                return std::pair{SplitNodeType::Clique, SplitTreeNode::NoVertex};
+            }
+            if (n >= 3 && numFull == 1 && numLeaves == n - 1)
+            {
+                return std::pair{SplitNodeType::Star, centre};
+            }
+            return std::nullopt;
+        }
+
+        // G[side] plus a pending marker joined to every vertex of 'side' with a neighbour outside it.
+        [[nodiscard]] PendingGraph half(const PendingGraph &pending, const std::vector<int> &side)
+        {
+            const auto &graph = pending.graph;
+            std::vector<int> position(graph.numVertices(), -1);
+            for (auto i = 0; i < static_cast<int>(side.size()); ++i)
+            {
+                position[side[i]] = i;
+            }
+            const auto marker = static_cast<int>(side.size());
+
+            CsrGraph::Builder builder(marker + 1);
+            std::vector<int> labels;
+            labels.reserve(side.size() + 1);
+            for (auto u : side)
+            {
+                labels.push_back(pending.labels[u]);
+                auto isFrontier = false;
+                for (auto w : graph.neighbours(u))
+                {
+                    if (position[w] < 0)
+                    {
+                        isFrontier = true;
+                    }
+                    else if (u < w)
+                    {
+                        builder.addEdge(position[u], position[w]);
+                    }
+                }
+                if (isFrontier)
+                {
+                    builder.addEdge(position[u], marker);
+                }
+            }
+            labels.push_back(PendingGraph::PendingMarker);
+            return PendingGraph{std::move(labels), builder.build()};
+        }
+
+        [[nodiscard]] Outcome decomposeOne(const PendingGraph &pending)
+        {
+            if (const auto degenerate = degenerateType(pending.graph))
+            {
+                const auto [type, centre] = *degenerate;
+                return Outcome{SplitTreeNode{type, pending.labels, pending.graph, centre == SplitTreeNode::NoVertex ? centre : pending.labels[centre]}, {}};
+            }
+            SpinradPrime sp;
+            const auto split = sp.trySplit(pending.graph);
+            if (!split)
+            {
+                return Outcome{SplitTreeNode{SplitNodeType::Prime, pending.labels, pending.graph}, {}};
+            }
+            const auto &[v1, v2] = *split;
+            std::vector<PendingGraph> halves;
+            halves.push_back(half(pending, v1));
+            halves.push_back(half(pending, v2));
+            return Outcome{std::nullopt, std::move(halves)};
+        }
+
+        [[nodiscard]] CsrGraph degenerateGraph(SplitNodeType type, const std::vector<int> &vertices, int centre)
+        {
+            const auto n = static_cast<int>(vertices.size());
+            CsrGraph::Builder builder(n);
+            if (type == SplitNodeType::Clique)
+            {
+                builder.reserve(static_cast<std::size_t>(n) * (n - 1) / 2);
+                for (auto u = 0; u < n; ++u)
+                {
+                    for (auto v = u + 1; v < n; ++v)
+                    {
+                        builder.addEdge(u, v);
+                    }
+                }
+            }
+            else
+            {
+                const auto centrePosition = static_cast<int>(std::find(vertices.begin(), vertices.end(), centre) - vertices.begin());
+                for (auto v = 0; v < n; ++v)
+                {
+                    if (v != centrePosition)
+                    {
+                        builder.addEdge(centrePosition, v);
+                    }
+                }
+            }
+            return builder.build();
+        }
+
+        // Merges neighbouring clique nodes, and neighbouring star nodes whose tree edge joins the centre of one to a
+        // leaf of the other (the merged star keeps the second centre), then relabels the surviving markers densely.
+        [[nodiscard]] SplitTree reduce(int numVertices, std::vector<SplitTreeNode> nodes, const std::vector<int> &markerPartner)
+        {
+            const auto numMarkers = static_cast<int>(markerPartner.size());
+            std::vector<int> markerNode(numMarkers);
+            for (auto i = 0; i < static_cast<int>(nodes.size()); ++i)
+            {
+                for (auto v : nodes[i].vertices)
+                {
+                    if (v >= numVertices)
+                    {
+                        markerNode[v - numVertices] = i;
+                    }
+                }
+            }
+
+            std::vector<int> parent(nodes.size());
+            std::iota(parent.begin(), parent.end(), 0);
+            const auto find = [&](int i)
+            {
+                while (parent[i] != i)
+                {
+                    parent[i] = parent[parent[i]];
+                    i = parent[i];
+                }
+                return i;
+            };
+
+            std::vector<bool> isRemoved(numMarkers, false);
+            std::vector<bool> isMerged(nodes.size(), false);
+            for (auto m = numVertices; m < numVertices + numMarkers; ++m)
+            {
+                const auto other = markerPartner[m - numVertices];
+                if (other < m)
+                {
+                    continue;
+                }
+                auto a = find(markerNode[m - numVertices]);
+                auto b = find(markerNode[other - numVertices]);
+                const auto bothCliques = nodes[a].type == SplitNodeType::Clique && nodes[b].type == SplitNodeType::Clique;
+                const auto centreToLeaf = nodes[a].type == SplitNodeType::Star && nodes[b].type == SplitNodeType::Star &&
+                                          (nodes[a].centre == m) != (nodes[b].centre == other);
+                if (!bothCliques && !centreToLeaf)
+                {
+                    continue;
+                }
+                const auto centre = !centreToLeaf ? SplitTreeNode::NoVertex : nodes[a].centre == m ? nodes[b].centre : nodes[a].centre;
+
+                // Small into large, so that every vertex moves O(log n) times.
+                if (nodes[a].vertices.size() < nodes[b].vertices.size())
+                {
+                    std::swap(a, b);
+                }
+                nodes[a].vertices.insert(nodes[a].vertices.end(), nodes[b].vertices.begin(), nodes[b].vertices.end());
+                nodes[b].vertices = {};
+                nodes[a].centre = centre;
+                parent[b] = a;
+                isMerged[a] = true;
+                isRemoved[m - numVertices] = true;
+                isRemoved[other - numVertices] = true;
+            }
+
+            std::vector<int> relabel(numMarkers, -1);
+            auto numKept = 0;
+            for (auto m = 0; m < numMarkers; ++m)
+            {
+                if (!isRemoved[m])
+                {
+                    relabel[m] = numVertices + numKept++;
+                }
+            }
+            const auto label = [&](int v) { return v >= numVertices ? relabel[v - numVertices] : v; };
+
+            std::vector<int> keptPartner(numKept);
+            for (auto m = 0; m < numMarkers; ++m)
+            {
+                if (!isRemoved[m])
+                {
+                    keptPartner[relabel[m] - numVertices] = label(markerPartner[m]);
+                }
+            }
+
+            std::vector<SplitTreeNode> reduced;
+            for (auto i = 0; i < static_cast<int>(nodes.size()); ++i)
+            {
+                if (find(i) != i)
+                {
+                    continue;
+                }
+                auto &node = nodes[i];
+                std::erase_if(node.vertices, [&](int v) { return v >= numVertices && isRemoved[v - numVertices]; });
+                std::ranges::transform(node.vertices, node.vertices.begin(), label);
+                if (node.centre != SplitTreeNode::NoVertex)
+                {
+                    node.centre = label(node.centre);
+                }
+                if (isMerged[i])
+                {
+                    node.graph = degenerateGraph(node.type, node.vertices, node.centre);
+                }
+                reduced.push_back(std::move(node));
+            }
+            return SplitTree(numVertices, std::move(reduced), std::move(keptPartner));
+        }
+    }
+
+    SplitTree::SplitTree(int numVertices, std::vector<SplitTreeNode> nodes, std::vector<int> markerPartner) :
+        _numVertices(numVertices), _nodes(std::move(nodes)), _markerPartner(std::move(markerPartner)), _markerNode(_markerPartner.size(), -1)
+    {
+        for (auto i = 0; i < static_cast<int>(_nodes.size()); ++i)
+        {
+            for (auto v : _nodes[i].vertices)
+            {
+                if (isMarker(v))
+                {
+                    _markerNode[v - _numVertices] = i;
+                }
+            }
+        }
+    }
+
+    SplitTree SplitDecomposition::decompose(const cg::data_structures::CsrGraph &graph, int threadCount)
+    {
+        if (!isConnected(graph))
+        {
+            throw std::invalid_argument("Split decomposition needs a connected graph");
+        }
+        const auto n = graph.numVertices();
+        std::vector<int> labels(n);
+        std::iota(labels.begin(), labels.end(), 0);
+        std::vector<PendingGraph> pending;
+        pending.push_back(PendingGraph{std::move(labels), graph});
+
+        std::vector<SplitTreeNode> nodes;
+        std::vector<int> markerPartner;
+        ThreadPool pool(threadCount);
+        while (!pending.empty())
+        {
+            std::vector<Outcome> outcomes(pending.size());
+            pool.parallelFor(static_cast<int>(pending.size()), 1, [&](int begin, int end)
+            {
+                for (auto i = begin; i < end; ++i)
+                {
+                    outcomes[i] = decomposeOne(pending[i]);
+                }
+            });
+
+            // Commit the round in order, so the labels do not depend on the thread count.
+            std::vector<PendingGraph> next;
+            for (auto &outcome : outcomes)
+            {
+                if (outcome.node)
+                {
+                    nodes.push_back(std::move(*outcome.node));
+                    continue;
+                }
+                const auto marker = n + static_cast<int>(markerPartner.size());
+                markerPartner.push_back(marker + 1);
+                markerPartner.push_back(marker);
+                outcome.halves[0].labels.back() = marker;
+                outcome.halves[1].labels.back() = marker + 1;
+                next.push_back(std::move(outcome.halves[0]));
+                next.push_back(std::move(outcome.halves[1]));
+            }
+            pending = std::move(next);
+        }
+        return reduce(n, std::move(nodes), markerPartner);
+    }
+}
@@ -0,0 +1,125 @@
+#include "utils/thread_pool.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace cg::utils
+{
+    ThreadPool::ThreadPool(int threadCount)
+    {
+        const auto workerCount = resolveThreadCount(threadCount) - 1;
+        _workers.reserve(workerCount);
+        for (auto i = 0; i < workerCount; ++i)
+        {
+            _workers.emplace_back([this] { workerLoop(); });
+        }
+    }
+
+    ThreadPool::~ThreadPool()
+    {
+        {
+            std::lock_guard lock(_mutex);
+            _stopping = true;
+        }
+        _wake.notify_all();
+        for (auto &worker : _workers)
+        {
+            worker.join();
+        }
+    }
+
+    int ThreadPool::resolveThreadCount(int threadCount)
+    {
+        if (threadCount >= 1)
+        {
+            return threadCount;
+        }
+        return std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+    }
+
+    int ThreadPool::chunkSizeFor(int count, int minChunkSize) const
+    {
+        constexpr auto chunksPerThread = 4;
+        return std::max({1, minChunkSize, count / (threadCount() * chunksPerThread)});
+    }
+
+    void ThreadPool::runParallel(int count, int chunkSize, const std::function<void(int, int)> &body)
+    {
+        {
+            std::lock_guard lock(_mutex);
+            _body = &body;
+            _count = count;
+            _chunkSize = chunkSize;
+            _nextIndex.store(0, std::memory_order_relaxed);
+            _error = nullptr;
+            _busyWorkers = _workers.size();
+            ++_generation;
+        }
+        _wake.notify_all();
+
+        runChunks();
+
+        std::exception_ptr error;
+        {
+            std::unique_lock lock(_mutex);
+            _done.wait(lock, [this] { return _busyWorkers == 0; });
+            _body = nullptr;
+            error = std::exchange(_error, nullptr);
+        }
+        if (error)
+        {
+            std::rethrow_exception(error);
+        }
+    }
+
+    void ThreadPool::workerLoop()
+    {
+        std::size_t seenGeneration = 0;
+        while (true)
+        {
+            {
+                std::unique_lock lock(_mutex);
+                _wake.wait(lock, [&] { return _stopping || _generation != seenGeneration; });
+                if (_stopping)
+                {
+                    return;
+                }
+                seenGeneration = _generation;
+            }
+
+            runChunks();
+
+            {
+                std::lock_guard lock(_mutex);
+                if (--_busyWorkers == 0)
+                {
+                    _done.notify_one();
+                }
+            }
+        }
+    }
+
+    void ThreadPool::runChunks()
+    {
+        while (true)
+        {
+            const auto begin = _nextIndex.fetch_add(_chunkSize, std::memory_order_relaxed);
+            if (begin >= _count)
+            {
+                return;
+            }
+            try
+            {
+                (*_body)(begin, std::min(begin + _chunkSize, _count));
+            }
+            catch (...)
+            {
+                std::lock_guard lock(_mutex);
+                if (!_error)
+                {
+                    _error = std::current_exception();
+                }
+            }
+        }
+    }
+}
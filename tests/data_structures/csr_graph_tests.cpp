@@ -0,0 +1,110 @@
+#include "doctest/doctest.h"
+
+#include <algorithm>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "data_structures/graph.h"
+#include "data_structures/csr_graph.h"
+#include "data_structures/interval.h"
+#include "data_structures/distinct_interval_model.h"
+#include "data_structures/chord.h"
+#include "data_structures/chord_model.h"
+#include "utils/interval_model_utils.h"
+
+TEST_CASE("[CsrGraph] Builder sorts, symmetrises and deduplicates the edge list")
+{
+    cg::data_structures::CsrGraph::Builder builder(5);
+    builder.addEdge(3, 0);
+    builder.addEdge(0, 1);
+    builder.addEdge(1, 0);
+    builder.addEdge(0, 3);
+    builder.addEdge(2, 2);
+    builder.addEdge(4, 1);
+    const auto g = builder.build();
+
+    CHECK_EQ(g.numVertices(), 5);
+    CHECK_EQ(g.numEdgeEnds(), 7);
+    CHECK(std::ranges::equal(g.neighbours(0), std::vector<int>{1, 3}));
+    CHECK(std::ranges::equal(g.neighbours(1), std::vector<int>{0, 4}));
+    CHECK(std::ranges::equal(g.neighbours(2), std::vector<int>{2}));
+    CHECK(std::ranges::equal(g.neighbours(3), std::vector<int>{0}));
+    CHECK(std::ranges::equal(g.neighbours(4), std::vector<int>{1}));
+    CHECK(g.hasEdge(1, 4));
+    CHECK(g.hasEdge(2, 2));
+    CHECK_FALSE(g.hasEdge(3, 4));
+
+    CHECK_THROWS_AS(builder.addEdge(0, 5), std::out_of_range);
+    CHECK_THROWS_AS(static_cast<void>(g.neighbours(-1)), std::out_of_range);
+    CHECK_EQ(cg::data_structures::CsrGraph::Builder(0).build().numVertices(), 0);
+}
+
+TEST_CASE("[CsrGraph] Agrees with Graph on random graphs")
+{
+    std::mt19937 rng(1729);
+    for (auto trial = 0; trial < 20; ++trial)
+    {
+        const auto n = 1 + static_cast<int>(rng() % 40);
+        const auto numEdges = static_cast<int>(rng() % (n * n));
+        cg::data_structures::Graph graph(n);
+        cg::data_structures::CsrGraph::Builder builder(n);
+        for (auto e = 0; e < numEdges; ++e)
+        {
+            const auto u = static_cast<int>(rng() % n);
+            const auto v = static_cast<int>(rng() % n);
+            graph.addEdge(u, v);
+            builder.addEdge(u, v);
+        }
+
+        const auto built = builder.build();
+        const cg::data_structures::CsrGraph converted(graph);
+        for (auto u = 0; u < n; ++u)
+        {
+            std::vector<int> expected(graph.neighbours(u).begin(), graph.neighbours(u).end());
+            std::sort(expected.begin(), expected.end());
+            CHECK(std::ranges::equal(built.neighbours(u), expected));
+            CHECK(std::ranges::equal(converted.neighbours(u), expected));
+            for (auto v = 0; v < n; ++v)
+            {
+                CHECK_EQ(built.hasEdge(u, v), graph.hasEdge(u, v));
+            }
+        }
+    }
+}
+
+TEST_CASE("[CsrGraph] Interval and chord model factories match pairwise crossing tests")
+{
+    for (auto seed = 0; seed < 12; ++seed)
+    {
+        const auto n = 1 + 7 * seed;
+        auto intervals = seed % 3 == 2
+            ? cg::interval_model_utils::generatePrimeNestedIntervals(n)
+            : cg::interval_model_utils::generateRandomIntervals(n, 404 + seed);
+        std::ranges::sort(intervals, {}, &cg::data_structures::Interval::Index);
+        const cg::data_structures::DistinctIntervalModel model(intervals);
+        std::vector<cg::data_structures::Chord> chords;
+        for (const auto &interval : intervals)
+        {
+            chords.emplace_back(interval.Right, interval.Left, interval.Index, interval.Weight);
+        }
+        const cg::data_structures::ChordModel chordModel(chords);
+
+        for (const auto threadCount : {1, 3})
+        {
+            const auto fromIntervals = cg::data_structures::CsrGraph::fromIntervalModel(model, threadCount);
+            const auto fromChords = cg::data_structures::CsrGraph::fromChordModel(chordModel, threadCount);
+            REQUIRE_EQ(fromIntervals.numVertices(), static_cast<int>(intervals.size()));
+            REQUIRE_EQ(fromChords.numVertices(), static_cast<int>(intervals.size()));
+            for (const auto &a : intervals)
+            {
+                CHECK(std::ranges::is_sorted(fromIntervals.neighbours(a.Index)));
+                for (const auto &b : intervals)
+                {
+                    CHECK_EQ(fromIntervals.hasEdge(a.Index, b.Index), a.overlaps(b));
+                    CHECK_EQ(fromChords.hasEdge(a.Index, b.Index), chords[a.Index].intersects(chords[b.Index]));
+                }
+            }
+        }
+    }
+}
@@ -61,3 +61,42 @@ TEST_CASE("DistinctIntervalModel endpoint iteration")
         CHECK_EQ(i, expectedLeftDesc.size());
     }
 }
+
+TEST_CASE("DistinctIntervalModel predecessor queries")
+{
+    using cg::data_structures::Interval;
+    // [0,3], [1,2], [4,7], [5,6]
+    std::vector<Interval> intervals{
+        Interval{0,3,0,1},
+        Interval{1,2,1,1},
+        Interval{4,7,2,1},
+        Interval{5,6,3,1},
+    };
+    cg::data_structures::DistinctIntervalModel model(intervals);
+
+    CHECK_FALSE(model.tryGetRightEndpointPredecessorInterval(0));
+    CHECK_FALSE(model.tryGetRightEndpointPredecessorInterval(2));
+    CHECK_EQ(model.tryGetRightEndpointPredecessorInterval(3)->Index, 1);
+    CHECK_EQ(model.tryGetRightEndpointPredecessorInterval(4)->Index, 0);
+    CHECK_EQ(model.tryGetRightEndpointPredecessorInterval(6)->Index, 0);
+    CHECK_EQ(model.tryGetRightEndpointPredecessorInterval(7)->Index, 3);
+    CHECK_EQ(model.tryGetRightEndpointPredecessorInterval(8)->Index, 2);
+
+    CHECK_FALSE(model.tryGetLeftEndpointPredecessorInterval(0));
+    CHECK_EQ(model.tryGetLeftEndpointPredecessorInterval(1)->Index, 0);
+    CHECK_EQ(model.tryGetLeftEndpointPredecessorInterval(4)->Index, 1);
+    CHECK_EQ(model.tryGetLeftEndpointPredecessorInterval(8)->Index, 3);
+
+    // Bounds outside [0, end] are clamped: nothing lies below a negative bound, everything below a large one.
+    CHECK_FALSE(model.tryGetRightEndpointPredecessorInterval(-1));
+    CHECK_FALSE(model.tryGetLeftEndpointPredecessorInterval(-5));
+    CHECK_EQ(model.tryGetRightEndpointPredecessorInterval(100)->Index, 2);
+    CHECK_EQ(model.tryGetLeftEndpointPredecessorInterval(100)->Index, 3);
+
+    std::vector<int> chain;
+    for(auto right = model.rightEndpointPredecessor(model.end); right != cg::data_structures::DistinctIntervalModel::NoEndpoint; right = model.rightEndpointPredecessor(right))
+    {
+        chain.push_back(right);
+    }
+    CHECK_EQ(chain, std::vector<int>{7,6,3,2});
+}
@@ -5,6 +5,7 @@
 #include "utils/interval_model_utils.h"
 
 #include <algorithm>
+#include <cstdint>
 #include <numeric>
 #include <random>
 #include <vector>
@@ -408,6 +409,58 @@ TEST_CASE("[Gavril] Left dummy within right child") {
 
 
 
+TEST_CASE("[Gavril] Table stats report the exact peak on a nested chain") {
+    std::vector<cgtd::Interval> ivs;
+    ivs.push_back(mk(0,7,0));
+    ivs.push_back(mk(1,6,1));
+    ivs.push_back(mk(2,5,2));
+    ivs.push_back(mk(3,4,3));
+
+    // Two 8^4 tables each of ForestScore and ChildChoice cells, and two 8^3 tables of DummyForestScore cells.
+    const std::size_t end = 8;
+    const auto denseBytes = 2 * end * end * end * end * (sizeof(cg::mif::Gavril::ForestScore) + sizeof(cg::mif::Gavril::ChildChoice))
+                            + 2 * end * end * end * sizeof(cg::mif::Gavril::DummyForestScore);
+    // Every entry costs at least its key and value plus the hash node's next pointer.
+    const auto minEntryBytes = sizeof(std::uint64_t) + sizeof(void*) + sizeof(cg::mif::Gavril::ForestScore);
+
+    cg::mif::Gavril::TableStats all;
+    CHECK(cg::mif::Gavril::computeMif(ivs, all).size() == 4);
+    CHECK(all.storedEntries == 1109);
+    CHECK(all.denseBytes == denseBytes);
+    CHECK(all.memoryBytes >= all.storedEntries * minEntryBytes);
+
+    // The chain has four layers, and retiring layer 0 before layer 3's peak drops its score cells; its child
+    // choices are frozen, not dropped, so they still count.
+    cg::mif::Gavril::TableStats rolling;
+    CHECK(cg::mif::Gavril::computeMif(ivs, rolling, cg::mif::Gavril::LayerRetention::RollingLayers).size() == 4);
+    CHECK(rolling.storedEntries == 1096);
+    CHECK(rolling.denseBytes == denseBytes);
+    CHECK(rolling.memoryBytes < all.memoryBytes);
+}
+
+TEST_CASE("[Gavril] Rolling layer retention gives the same forests") {
+    std::mt19937 rng(424242);
+    for (int trial = 0; trial < 40; ++trial) {
+        int n = 3 + trial % 6;
+        std::vector<int> perm(2 * n);
+        std::iota(perm.begin(), perm.end(), 0);
+        std::shuffle(perm.begin(), perm.end(), rng);
+        const auto ivs = make_intervals_from_permutation(perm);
+
+        auto run = [&](cg::mif::Gavril::LayerRetention retention) {
+            cg::mif::Gavril::TableStats stats;
+            std::vector<int> idxs;
+            try {
+                for (const auto& iv : cg::mif::Gavril::computeMif(ivs, stats, retention)) idxs.push_back(iv.Index);
+            } catch (const std::exception&) {
+                idxs.push_back(-1);
+            }
+            return idxs;
+        };
+        CHECK(run(cg::mif::Gavril::LayerRetention::AllLayers) == run(cg::mif::Gavril::LayerRetention::RollingLayers));
+    }
+}
+
 // ---------- Randomized vs exhaustive (small n) --------------------------------
 TEST_CASE("[Gavril] Random small instances match brute force (n<=9)") {
     std::mt19937 rng(1234567);
@@ -0,0 +1,105 @@
+#include "doctest/doctest.h"
+
+#include "data_structures/interval.h"
+#include "data_structures/distinct_interval_model.h"
+#include "mif/interval_candidates.h"
+#include "mif/mif_rscan_n5_qspace.h"
+#include "mif/nick_simpler_mif.h"
+#include "utils/interval_model_utils.h"
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace
+{
+    [[nodiscard]] std::vector<int> toVector(std::span<const int> positions)
+    {
+        return {positions.begin(), positions.end()};
+    }
+
+    [[nodiscard]] std::vector<int> indicesOf(const std::vector<cg::data_structures::Interval> &intervals)
+    {
+        std::vector<int> indices;
+        for (const auto &interval : intervals)
+        {
+            indices.push_back(interval.Index);
+        }
+        return indices;
+    }
+}
+
+TEST_CASE("[IntervalCandidates] Lists match the filtered scans they replace")
+{
+    for (auto n : {1, 2, 5, 17})
+    {
+        for (auto seed = 0; seed < 5; ++seed)
+        {
+            const cg::data_structures::DistinctIntervalModel model(cg::interval_model_utils::generateRandomIntervals(n, seed));
+            const auto intervals = model.allIntervals();
+            const cg::mif::IntervalCandidates candidates(intervals);
+            const int M = 2 * n;
+
+            for (auto R = 0; R < M; ++R)
+            {
+                for (auto a = -1; a < M; ++a)
+                {
+                    std::vector<int> expected;
+                    for (auto v = 0; v < n; ++v)
+                    {
+                        if (a < intervals[v].Left && intervals[v].Right <= R)
+                        {
+                            expected.push_back(v);
+                        }
+                    }
+                    CHECK_EQ(toVector(candidates.nestedIn(a, R)), expected);
+                }
+            }
+
+            for (auto e = 0; e < M; ++e)
+            {
+                for (auto minLeft = 0; minLeft <= M; ++minLeft)
+                {
+                    std::vector<int> expected;
+                    for (auto v = 0; v < n; ++v)
+                    {
+                        if (minLeft <= intervals[v].Left && intervals[v].Left < e && e < intervals[v].Right)
+                        {
+                            expected.push_back(v);
+                        }
+                    }
+                    CHECK_EQ(toVector(candidates.crossing(e, minLeft)), expected);
+                }
+                const auto atLeft = candidates.byLeft(e);
+                const auto atRight = candidates.byRight(e);
+                CHECK_NE(atLeft == -1, atRight == -1);
+                CHECK((atLeft == -1 || intervals[atLeft].Left == e));
+                CHECK((atRight == -1 || intervals[atRight].Right == e));
+            }
+        }
+    }
+}
+
+TEST_CASE("[IntervalCandidates] The MIF DPs give the same results without pruning")
+{
+    for (auto n : {1, 6, 13, 20})
+    {
+        for (auto seed = 0; seed < 3; ++seed)
+        {
+            const cg::data_structures::DistinctIntervalModel model(cg::interval_model_utils::generateRandomIntervals(n, seed));
+            const auto nick = cg::mif::NickSimplerMif::computeMif(model);
+            const auto rscan = cg::mif::MifRscanN5Qspace::computeMif(model);
+
+            cg::mif::setCandidatePruning(false);
+            CHECK_EQ(cg::mif::IntervalCandidates(model.allIntervals()).crossing(0).size(), static_cast<std::size_t>(n));
+            const auto nickFull = cg::mif::NickSimplerMif::computeMif(model);
+            const auto rscanFull = cg::mif::MifRscanN5Qspace::computeMif(model);
+            cg::mif::setCandidatePruning(true);
+
+            CHECK_EQ(nickFull.first, nick.first);
+            CHECK_EQ(indicesOf(nickFull.second), indicesOf(nick.second));
+            CHECK_EQ(rscanFull.first, rscan.first);
+            CHECK_EQ(indicesOf(rscanFull.second), indicesOf(rscan.second));
+        }
+    }
+}
@@ -452,4 +452,3 @@ TEST_CASE("[MifRscanN5Qspace] Random small instances match brute force (n<=9)")
         CHECK(mifRscanSize(intervals) == size);
     }
 }
-
@@ -2,6 +2,7 @@
 
 #include "data_structures/interval.h"
 #include "data_structures/distinct_interval_model.h"
+#include "mif/mif_rscan_n5_qspace.h"
 #include "mif/nick_simpler_mif.h"
 
 #include <algorithm>
@@ -188,6 +189,29 @@ namespace
         cgtd::DistinctIntervalModel model(intervals);
         return cg::mif::NickSimplerMif::computeMif(model);
     }
+
+    template <typename TMif>
+    void checkThreadCountIndependence(int trials, int maxExtraIntervals)
+    {
+        std::mt19937 rng(7654321);
+        for (int trial = 0; trial < trials; ++trial)
+        {
+            const int n = 4 + (rng() % maxExtraIntervals);
+            std::vector<int> perm(2 * n);
+            std::iota(perm.begin(), perm.end(), 0);
+            std::shuffle(perm.begin(), perm.end(), rng);
+            const cgtd::DistinctIntervalModel model(makeIntervalsFromPermutation(perm));
+
+            const auto [size, pickedIntervals] = TMif::computeMif(model);
+            for (const int threadCount : {2, 3, 8})
+            {
+                const auto [parallelSize, parallelPicked] = TMif::computeMif(model, threadCount);
+                CHECK(parallelSize == size);
+                CHECK(extractIndices(parallelPicked) == extractIndices(pickedIntervals));
+                CHECK(TMif::computeMifSize(model, threadCount) == size);
+            }
+        }
+    }
 }
 
 TEST_CASE("[NickSimplerMif] Single edge is fully kept")
@@ -453,3 +477,27 @@ TEST_CASE("[NickSimplerMif] Random small instances match brute force (n<=9)")
     }
 }
 
+TEST_CASE("[MIF] NickSimplerMif and MifRscanN5Qspace results do not depend on the thread count")
+{
+    checkThreadCountIndependence<cg::mif::NickSimplerMif>(40, 12);
+    checkThreadCountIndependence<cg::mif::MifRscanN5Qspace>(30, 20);
+}
+
+TEST_CASE("[NickSimplerMif] Larger random instances match MifRscanN5Qspace")
+{
+    std::mt19937 rng(2468);
+    for (int trial = 0; trial < 20; ++trial)
+    {
+        const int n = 20 + (rng() % 16);
+        std::vector<int> perm(2 * n);
+        std::iota(perm.begin(), perm.end(), 0);
+        std::shuffle(perm.begin(), perm.end(), rng);
+        const auto intervals = makeIntervalsFromPermutation(perm);
+        const cgtd::DistinctIntervalModel model(intervals);
+
+        const auto [size, pickedIntervals] = cg::mif::NickSimplerMif::computeMif(model);
+        CHECK(size == cg::mif::MifRscanN5Qspace::computeMifSize(model));
+        CHECK(static_cast<int>(pickedIntervals.size()) == size);
+        CHECK(isForestInduced(intervals, extractIndices(pickedIntervals)));
+    }
+}
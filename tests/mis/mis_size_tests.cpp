@@ -0,0 +1,69 @@
+#include "doctest/doctest.h"
+
+#include <limits>
+#include <vector>
+
+#include "data_structures/interval.h"
+#include "data_structures/distinct_interval_model.h"
+#include "data_structures/shared_interval_model.h"
+#include "mis/distinct/naive.h"
+#include "mis/distinct/valiente.h"
+#include "mis/distinct/pure_output_sensitive.h"
+#include "mis/shared/naive.h"
+#include "mis/shared/valiente.h"
+#include "mis/shared/pure_output_sensitive.h"
+#include "mis/shared/pruned_output_sensitive.h"
+#include "utils/counters.h"
+#include "utils/interval_model_utils.h"
+
+namespace
+{
+    constexpr int Unbounded = std::numeric_limits<int>::max();
+
+    void checkDistinctSizes(const std::vector<cg::data_structures::Interval> &intervals)
+    {
+        const cg::data_structures::DistinctIntervalModel model(intervals);
+        const auto expected = static_cast<int>(cg::mis::distinct::Naive::computeMIS(model).size());
+
+        CHECK_EQ(cg::mis::distinct::Naive::computeMISSize(model), expected);
+        CHECK_EQ(cg::mis::distinct::Valiente::computeMISSize(model), expected);
+        cg::utils::Counters<cg::mis::distinct::PureOutputSensitive::Counts> pureCounts;
+        CHECK_EQ(cg::mis::distinct::PureOutputSensitive::tryComputeMISSize(model, Unbounded, pureCounts), expected);
+    }
+
+    void checkSharedSizes(const std::vector<cg::data_structures::Interval> &intervals)
+    {
+        const cg::data_structures::SharedIntervalModel model(intervals);
+        cg::utils::Counters<cg::mis::shared::Naive::Counts> naiveCounts;
+        const auto expected = static_cast<int>(cg::mis::shared::Naive::computeMIS(model, naiveCounts).size());
+
+        CHECK_EQ(cg::mis::shared::Naive::computeMISSize(model, naiveCounts), expected);
+        cg::utils::Counters<cg::mis::shared::Valiente::Counts> valienteCounts;
+        CHECK_EQ(cg::mis::shared::Valiente::computeMISSize(model, valienteCounts), expected);
+        cg::utils::Counters<cg::mis::shared::PureOutputSensitive::Counts> pureCounts;
+        CHECK_EQ(cg::mis::shared::PureOutputSensitive::tryComputeMISSize(model, Unbounded, pureCounts), expected);
+        cg::utils::Counters<cg::mis::shared::PrunedOutputSensitive::Counts> prunedCounts;
+        CHECK_EQ(cg::mis::shared::PrunedOutputSensitive::tryComputeMISSize(model, Unbounded, prunedCounts), expected);
+    }
+}
+
+TEST_CASE("[MIS] Size-only entry points match the reconstructed set (distinct)")
+{
+    for (auto seed = 0; seed < 20; ++seed)
+    {
+        checkDistinctSizes(cg::interval_model_utils::generateRandomIntervals(1 + 5 * seed, seed));
+    }
+    for (auto numLayers = 1; numLayers < 10; ++numLayers)
+    {
+        checkDistinctSizes(cg::interval_model_utils::generateLayeredHardCaseNonPrime(numLayers));
+    }
+}
+
+TEST_CASE("[MIS] Size-only entry points match the reconstructed set (shared)")
+{
+    for (auto seed = 0; seed < 20; ++seed)
+    {
+        checkSharedSizes(cg::interval_model_utils::generateRandomIntervalsShared(5 + 4 * seed, 4, 10, seed));
+    }
+}
+
@@ -0,0 +1,135 @@
+#include "doctest/doctest.h"
+
+#include <limits>
+#include <optional>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "data_structures/interval.h"
+#include "data_structures/distinct_interval_model.h"
+#include "mis/monotone_seq.h"
+#include "mis/segment_tree_monotone_seq.h"
+#include "mis/unit_monotone_seq.h"
+#include "mis/flat_unit_monotone_seq.h"
+#include "mis/distinct/lazy_output_sensitive.h"
+#include "mis/distinct/implicit_output_sensitive.h"
+#include "mis/distinct/simple_implicit_output_sensitive.h"
+#include "utils/counters.h"
+#include "utils/interval_model_utils.h"
+
+TEST_CASE("[MonotoneSeq] Segment tree matches the vector implementation")
+{
+    for (auto size : {1, 2, 7, 64, 100, 513})
+    {
+        cg::mis::MonotoneSeq expected(size);
+        cg::mis::SegmentTreeMonotoneSeq actual(size);
+        std::mt19937 rng(size);
+        std::uniform_int_distribution<int> index(0, size - 1);
+        std::uniform_int_distribution<int> step(1, 3);
+
+        for (auto op = 0; op < 4 * size; ++op)
+        {
+            const auto idx = index(rng);
+            const auto value = expected.get(idx) + step(rng);
+            const auto expectedRange = expected.set(idx, value);
+            const auto actualRange = actual.set(idx, value);
+            CHECK_EQ(actualRange.changeStartInclusive, expectedRange.changeStartInclusive);
+            CHECK_EQ(actualRange.changeEndExclusive, expectedRange.changeEndExclusive);
+        }
+        for (auto idx = 0; idx <= size; ++idx)
+        {
+            CHECK_EQ(actual.get(idx), expected.get(idx));
+        }
+
+        std::vector<int> expectedValues;
+        std::vector<int> actualValues;
+        expected.copyTo(expectedValues);
+        actual.copyTo(actualValues);
+        CHECK_EQ(actualValues, expectedValues);
+    }
+}
+
+TEST_CASE("[MonotoneSeq] Segment tree rejects invalid updates")
+{
+    cg::mis::SegmentTreeMonotoneSeq seq(4);
+    seq.set(2, 5);
+    CHECK_THROWS_AS(seq.set(4, 1), std::out_of_range);
+    CHECK_THROWS_AS(seq.set(1, 5), std::out_of_range);
+}
+
+TEST_CASE("[MonotoneSeq] LazyOutputSensitive gives the same size with either sequence")
+{
+    for (auto numLayers = 1; numLayers < 12; ++numLayers)
+    {
+        const cg::data_structures::DistinctIntervalModel model(cg::interval_model_utils::generateLayeredHardCaseNonPrime(numLayers));
+        cg::utils::Counters<cg::mis::distinct::LazyOutputSensitive::Counts> counts;
+        const auto linear = cg::mis::distinct::LazyOutputSensitive::tryComputeMISSize<cg::mis::MonotoneSeq>(model, std::numeric_limits<int>::max(), counts);
+        const auto logarithmic = cg::mis::distinct::LazyOutputSensitive::tryComputeMISSize<cg::mis::SegmentTreeMonotoneSeq>(model, std::numeric_limits<int>::max(), counts);
+        CHECK_EQ(logarithmic, linear);
+    }
+}
+
+TEST_CASE("[UnitMonotoneSeq] Flat run set matches the map implementation")
+{
+    for (auto size : {1, 2, 63, 64, 65, 200, 4500})
+    {
+        cg::mis::UnitMonotoneSeq expected(size);
+        cg::mis::FlatUnitMonotoneSeq actual(size);
+        std::mt19937 rng(size);
+        std::uniform_int_distribution<int> index(0, size - 1);
+
+        for (auto op = 0; op < 3 * size; ++op)
+        {
+            const auto idx = index(rng);
+            const auto expectedRange = expected.increment(idx);
+            const auto actualRange = actual.increment(idx);
+            CHECK_EQ(actualRange.left, expectedRange.left);
+            CHECK_EQ(actualRange.changePoint, expectedRange.changePoint);
+            CHECK_EQ(actualRange.right, expectedRange.right);
+        }
+        for (auto idx = 0; idx < size; ++idx)
+        {
+            CHECK_EQ(actual.get(idx), expected.get(idx));
+        }
+
+        std::vector<int> expectedValues(size);
+        std::vector<int> actualValues(size);
+        expected.copyTo(expectedValues);
+        actual.copyTo(actualValues);
+        CHECK_EQ(actualValues, expectedValues);
+        CHECK_THROWS_AS(actual.increment(size), std::out_of_range);
+    }
+}
+
+namespace
+{
+    std::vector<int> indicesOf(const std::optional<std::vector<cg::data_structures::Interval>> &intervals)
+    {
+        std::vector<int> indices;
+        for (const auto &interval : intervals.value())
+        {
+            indices.push_back(interval.Index);
+        }
+        return indices;
+    }
+}
+
+TEST_CASE("[UnitMonotoneSeq] Implicit solvers give the same sets with either run structure")
+{
+    const auto unbounded = std::numeric_limits<int>::max();
+    for (auto seed = 0; seed < 10; ++seed)
+    {
+        const cg::data_structures::DistinctIntervalModel model(cg::interval_model_utils::generateRandomIntervals(50 + 20 * seed, seed));
+
+        cg::utils::Counters<cg::mis::distinct::ImplicitOutputSensitive::Counts> implicitCounts;
+        const auto implicitMap = cg::mis::distinct::ImplicitOutputSensitive::tryComputeMIS<cg::mis::UnitMonotoneSeq>(model, unbounded, implicitCounts);
+        const auto implicitFlat = cg::mis::distinct::ImplicitOutputSensitive::tryComputeMIS<cg::mis::FlatUnitMonotoneSeq>(model, unbounded, implicitCounts);
+        CHECK_EQ(indicesOf(implicitFlat), indicesOf(implicitMap));
+
+        cg::utils::Counters<cg::mis::distinct::SimpleImplicitOutputSensitive::Counts> simpleCounts;
+        const auto simpleMap = cg::mis::distinct::SimpleImplicitOutputSensitive::tryComputeMIS<cg::mis::UnitMonotoneSeq>(model, unbounded, simpleCounts);
+        const auto simpleFlat = cg::mis::distinct::SimpleImplicitOutputSensitive::tryComputeMIS<cg::mis::FlatUnitMonotoneSeq>(model, unbounded, simpleCounts);
+        CHECK_EQ(indicesOf(simpleFlat), indicesOf(simpleMap));
+    }
+}
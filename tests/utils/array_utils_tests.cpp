@@ -0,0 +1,83 @@
+#include "doctest/doctest.h"
+
+#include <cstdint>
+#include <set>
+#include <tuple>
+#include <type_traits>
+
+#include "utils/array_utils.h"
+
+namespace
+{
+    template <class Table>
+    void checkDistinctCells(int d0, int d1, int d2)
+    {
+        Table table(d0, d1, d2, -1);
+        CHECK_EQ(reinterpret_cast<std::uintptr_t>(table.data.data()) % 64, 0);
+
+        std::set<const int *> addresses;
+        for (auto i = 0; i < d0; ++i)
+        {
+            for (auto j = 0; j < d1; ++j)
+            {
+                for (auto k = 0; k < d2; ++k)
+                {
+                    table(i, j, k) = (i * d1 + j) * d2 + k;
+                    addresses.insert(&table(i, j, k));
+                }
+            }
+        }
+        CHECK_EQ(static_cast<int>(addresses.size()), d0 * d1 * d2);
+        for (auto i = 0; i < d0; ++i)
+        {
+            for (auto j = 0; j < d1; ++j)
+            {
+                for (auto k = 0; k < d2; ++k)
+                {
+                    CHECK_EQ(table(i, j, k), (i * d1 + j) * d2 + k);
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("[ArrayUtils] Every layout maps cells to distinct, aligned storage")
+{
+    using cg::utils::DimOrder;
+    for (const auto &[d0, d1, d2] : {std::tuple{1, 1, 1}, std::tuple{3, 10, 7}, std::tuple{9, 17, 16}})
+    {
+        checkDistinctCells<cg::utils::array3<int>>(d0, d1, d2);
+        checkDistinctCells<cg::utils::tiled_array3<int, DimOrder::IJK, 0>>(d0, d1, d2);
+        checkDistinctCells<cg::utils::tiled_array3<int, DimOrder::IKJ, 0>>(d0, d1, d2);
+        checkDistinctCells<cg::utils::tiled_array3<int, DimOrder::JKI, 2>>(d0, d1, d2);
+        checkDistinctCells<cg::utils::tiled_array3<int, DimOrder::KJI, 3>>(d0, d1, d2);
+        checkDistinctCells<cg::utils::tiled_array3<int, DimOrder::IJK, 4>>(d0, d1, d2);
+    }
+}
+
+TEST_CASE("[ArrayUtils] Tiled layouts keep a tile's rows together")
+{
+    cg::utils::tiled_array3<int, cg::utils::DimOrder::IJK, 3> table(2, 16, 16, 0);
+    // Within an 8 x 8 tile, stepping the middle coordinate moves by one tile row of 8 cells.
+    CHECK_EQ(&table(1, 1, 0) - &table(1, 0, 0), 8);
+    CHECK_EQ(&table(1, 0, 1) - &table(1, 0, 0), 1);
+    CHECK_EQ(&table(1, 0, 8) - &table(1, 0, 0), 64);
+
+    cg::utils::tiled_array3<int, cg::utils::DimOrder::IKJ, 0> transposed(2, 5, 7, 0);
+    CHECK_EQ(&transposed(0, 1, 0) - &transposed(0, 0, 0), 1);
+    CHECK_EQ(&transposed(0, 0, 1) - &transposed(0, 0, 0), 5);
+}
+
+TEST_CASE("[ArrayUtils] withNarrowestCell picks the smallest type holding the bound")
+{
+    const auto cellSize = [](std::size_t maxValue)
+    {
+        return cg::utils::withNarrowestCell(maxValue, []<typename TCell>(TCell) { return sizeof(TCell); });
+    };
+    CHECK_EQ(cellSize(0), 1);
+    CHECK_EQ(cellSize(255), 1);
+    CHECK_EQ(cellSize(256), 2);
+    CHECK_EQ(cellSize(65535), 2);
+    CHECK_EQ(cellSize(65536), sizeof(int));
+    CHECK(cg::utils::withNarrowestCell(100, []<typename TCell>(TCell) { return std::is_unsigned_v<TCell>; }));
+}
@@ -0,0 +1,95 @@
+#include "doctest/doctest.h"
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <set>
+#include <vector>
+
+#include "data_structures/interval.h"
+#include "data_structures/distinct_interval_model.h"
+#include "mif/nick_simpler_mif.h"
+#include "mis/distinct/naive.h"
+#include "utils/component_decomposition.h"
+#include "utils/components.h"
+#include "utils/interval_model_utils.h"
+
+#include "disconnected_intervals.h"
+
+namespace
+{
+    using cg::tests::randomDisconnectedIntervals;
+
+    [[nodiscard]] long long totalWeight(const std::vector<cg::data_structures::Interval> &intervals)
+    {
+        return std::accumulate(intervals.begin(), intervals.end(), 0LL, [](long long sum, const auto &interval) { return sum + interval.Weight; });
+    }
+}
+
+TEST_CASE("[ComponentDecomposition] Components are dense models covering every interval once")
+{
+    std::mt19937 rng(5150);
+    for (auto trial = 0; trial < 20; ++trial)
+    {
+        const auto intervals = randomDisconnectedIntervals(1 + static_cast<int>(rng() % 6), 8, rng);
+        const cg::data_structures::DistinctIntervalModel model(intervals);
+        const auto components = cg::components::decompose(model);
+        CHECK_EQ(components.size(), cg::components::getConnectedComponents(intervals).size());
+
+        std::set<int> seen;
+        for (std::size_t c = 0; c < components.size(); ++c)
+        {
+            const auto &component = components[c];
+            CHECK_EQ(component.model.end, 2 * component.model.size);
+            CHECK_EQ(static_cast<int>(component.originalIndex.size()), component.model.size);
+            if (c > 0)
+            {
+                CHECK(components[c - 1].model.size >= component.model.size);
+            }
+            for (const auto &interval : component.model.allIntervals())
+            {
+                const auto original = model.getIntervalByIndex(component.originalIndex[interval.Index]);
+                CHECK_EQ(original.Weight, interval.Weight);
+                seen.insert(original.Index);
+            }
+        }
+        CHECK_EQ(static_cast<int>(seen.size()), model.size);
+    }
+}
+
+TEST_CASE("[ComponentDecomposition] Per-component MIS and MIF match the whole-model solvers")
+{
+    std::mt19937 rng(8086);
+    for (auto trial = 0; trial < 15; ++trial)
+    {
+        const auto intervals = randomDisconnectedIntervals(2 + static_cast<int>(rng() % 4), 7, rng);
+        const cg::data_structures::DistinctIntervalModel model(intervals);
+        for (const auto threadCount : {1, 3})
+        {
+            const auto mis = cg::components::solvePerComponent(model, threadCount, [](const auto &component)
+            {
+                return cg::mis::distinct::Naive::computeMIS(component);
+            });
+            CHECK_EQ(totalWeight(mis), totalWeight(cg::mis::distinct::Naive::computeMIS(model)));
+            for (std::size_t i = 0; i < mis.size(); ++i)
+            {
+                for (std::size_t j = i + 1; j < mis.size(); ++j)
+                {
+                    CHECK_FALSE(mis[i].overlaps(mis[j]));
+                }
+            }
+
+            const auto mif = cg::components::solvePerComponent(model, threadCount, [](const auto &component)
+            {
+                return cg::mif::NickSimplerMif::computeMif(component).second;
+            });
+            const auto mifSize = cg::mif::NickSimplerMif::computeMifSize(model);
+            CHECK_EQ(static_cast<int>(mif.size()), mifSize);
+            CHECK(std::is_sorted(mif.begin(), mif.end(), [](const auto &lhs, const auto &rhs) { return lhs.Index < rhs.Index; }));
+            CHECK_EQ(cg::components::sumPerComponent(model, threadCount, [](const auto &component)
+            {
+                return cg::mif::NickSimplerMif::computeMifSize(component);
+            }), mifSize);
+        }
+    }
+}
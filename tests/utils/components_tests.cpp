@@ -0,0 +1,58 @@
+#include "doctest/doctest.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <random>
+#include <set>
+#include <vector>
+
+#include "data_structures/interval.h"
+#include "utils/components.h"
+#include "utils/interval_model_utils.h"
+
+#include "disconnected_intervals.h"
+
+TEST_CASE("[Components] Flat labels group the intervals like getConnectedComponents and the naive version")
+{
+    const auto groups = [](const std::vector<std::vector<cg::data_structures::Interval>> &components)
+    {
+        std::set<std::set<int>> result;
+        for (const auto &component : components)
+        {
+            std::set<int> indices;
+            for (const auto &interval : component)
+            {
+                indices.insert(interval.Index);
+            }
+            result.insert(std::move(indices));
+        }
+        return result;
+    };
+
+    std::mt19937 rng(1729);
+    for (auto trial = 0; trial < 40; ++trial)
+    {
+        auto intervals = trial % 2 == 0 ? cg::tests::randomDisconnectedIntervals(1 + static_cast<int>(rng() % 8), 10, rng)
+                                        : cg::interval_model_utils::generateRandomIntervals(1 + static_cast<int>(rng() % 30), static_cast<int>(rng()));
+        // Labels follow positions in the input, so shuffle it to tell positions and indices apart.
+        std::shuffle(intervals.begin(), intervals.end(), rng);
+        const auto [numComponents, labels] = cg::components::getConnectedComponentLabels(intervals);
+        REQUIRE_EQ(labels.size(), intervals.size());
+
+        std::vector<std::vector<cg::data_structures::Interval>> fromLabels(numComponents);
+        auto previousFirstLeft = -1;
+        for (std::size_t i = 0; i < intervals.size(); ++i)
+        {
+            fromLabels[labels[i]].push_back(intervals[i]);
+        }
+        for (const auto &component : fromLabels)
+        {
+            REQUIRE_FALSE(component.empty());
+            const auto firstLeft = std::ranges::min(component, {}, &cg::data_structures::Interval::Left).Left;
+            CHECK(firstLeft > previousFirstLeft);
+            previousFirstLeft = firstLeft;
+        }
+        CHECK_EQ(groups(fromLabels), groups(cg::components::getConnectedComponents(intervals)));
+        CHECK_EQ(groups(fromLabels), groups(cg::components::getConnectedComponentsNaive(intervals)));
+    }
+}
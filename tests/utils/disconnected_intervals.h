@@ -0,0 +1,33 @@
+#pragma once
+
+#include <random>
+#include <vector>
+
+#include "data_structures/interval.h"
+#include "utils/interval_model_utils.h"
+
+namespace cg::tests
+{
+    // Drops random models into random gaps of each other: every earlier interval either contains a whole piece or
+    // misses it, so the pieces never overlap one another and the graph has at least one component per piece.
+    inline std::vector<cg::data_structures::Interval> randomDisconnectedIntervals(int pieces, int maxPieceSize, std::mt19937 &rng)
+    {
+        std::vector<cg::data_structures::Interval> intervals;
+        for (auto piece = 0; piece < pieces; ++piece)
+        {
+            const auto size = 1 + static_cast<int>(rng() % maxPieceSize);
+            const auto gap = static_cast<int>(rng() % (2 * intervals.size() + 1));
+            for (auto &interval : intervals)
+            {
+                interval.Left += interval.Left >= gap ? 2 * size : 0;
+                interval.Right += interval.Right >= gap ? 2 * size : 0;
+            }
+            for (const auto &interval : cg::interval_model_utils::generateRandomIntervals(size, static_cast<int>(rng())))
+            {
+                const auto weight = 1 + static_cast<int>(rng() % 5);
+                intervals.emplace_back(interval.Left + gap, interval.Right + gap, static_cast<int>(intervals.size()), weight);
+            }
+        }
+        return intervals;
+    }
+}
@@ -0,0 +1,72 @@
+#include "doctest/doctest.h"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "utils/fenwick_max.h"
+#include "utils/fast_fenwick_max.h"
+
+TEST_CASE("[FastFenwickMax] Point updates and queries match FenwickMax")
+{
+    for (auto n : {1, 2, 3, 31, 64, 100, 1000})
+    {
+        cg::utils::FenwickMax expected(n, 0);
+        cg::utils::FastFenwickMax actual(n, 0);
+        std::mt19937 rng(n);
+        std::uniform_int_distribution<int> index(0, n - 1);
+        std::uniform_int_distribution<int> value(-50, 1000);
+        for (auto op = 0; op < 5 * n; ++op)
+        {
+            const auto idx = index(rng);
+            const auto v = value(rng);
+            expected.setIdx(idx, v);
+            actual.setIdx(idx, v);
+            const auto query = index(rng);
+            CHECK_EQ(actual.prefixMaxInclusive(query), expected.prefixMaxInclusive(query));
+        }
+    }
+}
+
+TEST_CASE("[FastFenwickMax] Bulk build and batched queries match point updates")
+{
+    for (auto n : {1, 5, 64, 257, 5000})
+    {
+        std::mt19937 rng(n);
+        std::uniform_int_distribution<int> value(0, 100000);
+        std::vector<int> values(n);
+        for (auto &v : values)
+        {
+            v = value(rng);
+        }
+
+        cg::utils::FenwickMax expected(n);
+        for (auto i = 0; i < n; ++i)
+        {
+            expected.setIdx(i, values[i]);
+        }
+        cg::utils::FastFenwickMax actual(n);
+        actual.build(values);
+
+        std::uniform_int_distribution<int> index(0, n - 1);
+        std::vector<int> queries(3 * n);
+        for (auto &q : queries)
+        {
+            q = index(rng);
+        }
+        std::vector<int> results(queries.size());
+
+        actual.prefixMaxInclusive(queries, results);
+        for (size_t k = 0; k < queries.size(); ++k)
+        {
+            CHECK_EQ(results[k], expected.prefixMaxInclusive(queries[k]));
+        }
+
+        std::sort(queries.begin(), queries.end());
+        actual.prefixMaxInclusive(queries, results);
+        for (size_t k = 0; k < queries.size(); ++k)
+        {
+            CHECK_EQ(results[k], expected.prefixMaxInclusive(queries[k]));
+        }
+    }
+}
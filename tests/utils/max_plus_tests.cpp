@@ -0,0 +1,72 @@
+#include "doctest/doctest.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "utils/max_plus.h"
+
+namespace
+{
+    template <class T>
+    void checkAgainstSerialScan(std::mt19937 &rng, int maxCell)
+    {
+        std::uniform_int_distribution<int> cell(0, maxCell);
+        for (auto count = 1; count <= 150; ++count)
+        {
+            std::vector<T> a(count);
+            std::vector<T> b(count);
+            for (auto i = 0; i < count; ++i)
+            {
+                a[i] = static_cast<T>(cell(rng));
+                b[i] = static_cast<T>(cell(rng));
+            }
+
+            auto best = std::numeric_limits<int>::min();
+            auto bestIndex = -1;
+            for (auto i = 0; i < count; ++i)
+            {
+                auto sum = static_cast<int>(a[i]) + static_cast<int>(b[i]);
+                if constexpr (sizeof(T) < sizeof(int))
+                {
+                    sum = std::min<int>(sum, std::numeric_limits<T>::max());
+                }
+                if (sum > best)
+                {
+                    best = sum;
+                    bestIndex = i;
+                }
+            }
+
+            CHECK_EQ(cg::utils::maxPlus(a.data(), b.data(), count), best);
+            const auto result = cg::utils::argMaxPlus(a.data(), b.data(), count);
+            CHECK_EQ(result.value, best);
+            CHECK_EQ(result.index, bestIndex);
+        }
+    }
+}
+
+TEST_CASE("[MaxPlus] Every supported level matches a serial scan")
+{
+    const auto supported = cg::utils::supportedSimdLevel();
+    std::mt19937 rng(31337);
+    for (auto level : {cg::utils::SimdLevel::Scalar, cg::utils::SimdLevel::Sse41, cg::utils::SimdLevel::Avx2, cg::utils::SimdLevel::Avx512})
+    {
+        if (level > supported)
+        {
+            continue;
+        }
+        CAPTURE(static_cast<int>(level));
+        CHECK_EQ(cg::utils::setSimdLevel(level), level);
+        // Small ranges produce many ties, the largest ones exercise saturation of the narrow types.
+        checkAgainstSerialScan<std::uint8_t>(rng, 3);
+        checkAgainstSerialScan<std::uint8_t>(rng, 255);
+        checkAgainstSerialScan<std::uint16_t>(rng, 5);
+        checkAgainstSerialScan<std::uint16_t>(rng, 65535);
+        checkAgainstSerialScan<int>(rng, 4);
+        checkAgainstSerialScan<int>(rng, 1 << 20);
+    }
+    CHECK_EQ(cg::utils::setSimdLevel(cg::utils::SimdLevel::Avx512), supported);
+}
@@ -0,0 +1,54 @@
+#include "doctest/doctest.h"
+
+#include "utils/sparse_array.h"
+
+TEST_CASE("[sparse_array4] Unwritten cells read as empty without being stored")
+{
+    cg::utils::sparse_array4<int> table(5, -1);
+    CHECK_EQ(table(1, 2, 3, 4), -1);
+    CHECK_EQ(table.size(), 0);
+
+    table.set(1, 2, 3, 4, 7);
+    table.set(4, 3, 2, 1, 8);
+    table.set(1, 2, 3, 4, 9);
+    CHECK_EQ(table(1, 2, 3, 4), 9);
+    CHECK_EQ(table(4, 3, 2, 1), 8);
+    CHECK_EQ(table(1, 2, 3, 3), -1);
+    CHECK_EQ(table(2, 1, 3, 4), -1);
+    CHECK_EQ(table.size(), 2);
+    CHECK_EQ(table.denseBytes(), 5 * 5 * 5 * 5 * sizeof(int));
+}
+
+TEST_CASE("[sparse_array4] Frozen and cleared layers")
+{
+    cg::utils::sparse_array4<int> table(6, -1);
+    for (auto i = 0; i < 6; ++i)
+    {
+        table.set(i, 5 - i, i % 3, 0, 10 * i);
+        table.set(i, i, i, 1, i);
+    }
+    table.freezeLayer(0);
+    for (auto i = 0; i < 6; ++i)
+    {
+        CHECK_EQ(table(i, 5 - i, i % 3, 0), 10 * i);
+        CHECK_EQ(table(i, 5 - i, (i + 1) % 3, 0), -1);
+    }
+    CHECK_EQ(table.size(), 12);
+
+    table.clearLayer(1);
+    CHECK_EQ(table(2, 2, 2, 1), -1);
+    CHECK_EQ(table(2, 3, 2, 0), 20);
+    CHECK_EQ(table.size(), 6);
+}
+
+TEST_CASE("[sparse_array3] Writes are kept per layer")
+{
+    cg::utils::sparse_array3<int> table(4, 0);
+    table.set(3, 3, 0, 5);
+    table.set(3, 3, 2, 6);
+    CHECK_EQ(table(3, 3, 0), 5);
+    CHECK_EQ(table(3, 3, 1), 0);
+    CHECK_EQ(table(3, 3, 2), 6);
+    CHECK_EQ(table(3, 3, 3), 0);
+    CHECK_EQ(table.size(), 2);
+}
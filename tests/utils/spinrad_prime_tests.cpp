@@ -1,6 +1,7 @@
 #include "doctest/doctest.h"
 #include "utils/spinrad_prime.h"
 #include "data_structures/graph.h"
+#include "data_structures/csr_graph.h"
 #include "data_structures/interval.h"
 #include "utils/interval_model_utils.h"
 #include "data_structures/distinct_interval_model.h"
@@ -9,6 +10,8 @@
 
 #include <iostream>
 #include <format>
+#include <bit>
+#include <random>
 
 TEST_CASE("SpinradPrime reports no split on cycles")
 {
@@ -263,3 +266,141 @@ TEST_CASE("SpinradPrime expt2")
     }*/
     CHECK_FALSE(sp.trySplit(g).has_value());
 }
+
+TEST_CASE("SpinradPrime gives the same answers on CsrGraph")
+{
+    for (auto n : {5, 10, 25, 50})
+    {
+        // Join of two cycles, with and without one missing join edge: split and no split respectively.
+        for (auto missingEdge : {false, true})
+        {
+            cg::data_structures::Graph g(2 * n);
+            for(auto i = 0; i < n - 1; ++i)
+            {
+                g.addEdge(i, i + 1);
+                g.addEdge(n + i, n + i + 1);
+            }
+            g.addEdge(n - 1, 0);
+            g.addEdge(2 * n - 1, n);
+            for(auto i = 0; i < n; ++i)
+            {
+                for(auto j = n; j < 2 * n; ++j)
+                {
+                    if (!missingEdge || i != n - 1 || j != 2 * n - 1)
+                    {
+                        g.addEdge(i, j);
+                    }
+                }
+            }
+            const cg::data_structures::CsrGraph csr(g);
+
+            cg::utils::SpinradPrime sp;
+            auto res = sp.trySplit(csr);
+            CHECK_EQ(res.has_value(), !missingEdge);
+            CHECK_EQ(res.has_value(), sp.trySplit(g).has_value());
+            if (res)
+            {
+                auto [v1, v2] = *res;
+                CHECK_NOTHROW(sp.verifySplit(csr, v1, v2));
+                CHECK_NOTHROW(sp.verifySplit(g, v1, v2));
+            }
+        }
+    }
+
+    auto intervals = cg::interval_model_utils::generatePrimeNestedIntervals(50);
+    cg::data_structures::CsrGraph::Builder builder(intervals.size());
+    for (int r = 0; r < intervals.size(); ++r)
+    {
+        for (int j = r + 1; j < intervals.size(); ++j)
+        {
+            if (intervals[r].overlaps(intervals[j]))
+            {
+                builder.addEdge(r, j);
+            }
+        }
+    }
+    cg::utils::SpinradPrime sp;
+    CHECK_FALSE(sp.trySplit(builder.build()).has_value());
+}
+
+TEST_CASE("SpinradPrime returns a split exactly when one exists on small random graphs")
+{
+    // (A, B) is a split when both sides have two vertices and the edges between them form a complete bipartite graph.
+    const auto isSplit = [](const cg::data_structures::CsrGraph &g, unsigned inA)
+    {
+        const auto n = g.numVertices();
+        const auto sizeA = std::popcount(inA);
+        if (sizeA < 2 || n - sizeA < 2)
+        {
+            return false;
+        }
+        std::vector<int> frontierA;
+        std::vector<int> frontierB;
+        for (auto v = 0; v < n; ++v)
+        {
+            const bool vInA = (inA >> v) & 1;
+            for (auto w : g.neighbours(v))
+            {
+                if (((inA >> w) & 1) != vInA)
+                {
+                    (vInA ? frontierA : frontierB).push_back(v);
+                    break;
+                }
+            }
+        }
+        for (auto a : frontierA)
+        {
+            for (auto b : frontierB)
+            {
+                if (!g.hasEdge(a, b))
+                {
+                    return false;
+                }
+            }
+        }
+        return true;
+    };
+
+    std::mt19937 rng(1);
+    for (auto trial = 0; trial < 3000; ++trial)
+    {
+        const auto n = 4 + static_cast<int>(rng() % 7);
+        const auto percent = 20 + static_cast<int>(rng() % 60);
+        cg::data_structures::CsrGraph::Builder builder(n);
+        for (auto v = 1; v < n; ++v)
+        {
+            builder.addEdge(v, static_cast<int>(rng() % v)); // Keeps the graph connected.
+        }
+        for (auto u = 0; u < n; ++u)
+        {
+            for (auto v = u + 1; v < n; ++v)
+            {
+                if (static_cast<int>(rng() % 100) < percent)
+                {
+                    builder.addEdge(u, v);
+                }
+            }
+        }
+        const auto g = builder.build();
+
+        auto hasSplit = false;
+        for (auto inA = 1u; inA < (1u << (n - 1)) && !hasSplit; ++inA)
+        {
+            hasSplit = isSplit(g, inA);
+        }
+        cg::utils::SpinradPrime sp;
+        const auto res = sp.trySplit(g);
+        REQUIRE_EQ(res.has_value(), hasSplit);
+        if (res)
+        {
+            auto [v1, v2] = *res;
+            CHECK_EQ(v1.size() + v2.size(), n);
+            auto inA = 0u;
+            for (auto v : v1)
+            {
+                inA |= 1u << v;
+            }
+            CHECK(isSplit(g, inA));
+        }
+    }
+}
@@ -0,0 +1,233 @@
+#include "doctest/doctest.h"
+
+#include <algorithm>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <vector>
+
+#include "data_structures/csr_graph.h"
+#include "data_structures/interval.h"
+#include "data_structures/distinct_interval_model.h"
+#include "utils/component_decomposition.h"
+#include "utils/interval_model_utils.h"
+#include "utils/spinrad_prime.h"
+#include "utils/split_decomposition.h"
+
+namespace
+{
+    using cg::data_structures::CsrGraph;
+    using cg::utils::SplitNodeType;
+
+    // The neighbours of original vertex u read off the tree: follow alternating paths out of u's node.
+    std::set<int> accessibleNeighbours(const cg::utils::SplitTree &tree, int nodeIndex, int u)
+    {
+        std::set<int> result;
+        std::vector<std::pair<int, int>> pending{{nodeIndex, u}}; // (node, vertex entering from / starting at)
+        while (!pending.empty())
+        {
+            const auto [current, from] = pending.back();
+            pending.pop_back();
+            const auto &node = tree.nodes()[current];
+            const auto local = static_cast<int>(std::find(node.vertices.begin(), node.vertices.end(), from) - node.vertices.begin());
+            for (auto w : node.graph.neighbours(local))
+            {
+                const auto label = node.vertices[w];
+                if (!tree.isMarker(label))
+                {
+                    result.insert(label);
+                }
+                else if (label != from)
+                {
+                    const auto partner = tree.partner(label);
+                    pending.emplace_back(tree.nodeOfMarker(partner), partner);
+                }
+            }
+        }
+        return result;
+    }
+
+    void checkDecomposition(const CsrGraph &graph)
+    {
+        const auto tree = cg::utils::SplitDecomposition::decompose(graph);
+        const auto &nodes = tree.nodes();
+        REQUIRE_EQ(tree.numVertices(), graph.numVertices());
+        CHECK(static_cast<int>(nodes.size()) <= std::max(1, graph.numVertices() - 2));
+
+        std::vector<int> originalNode(graph.numVertices(), -1);
+        for (auto i = 0; i < static_cast<int>(nodes.size()); ++i)
+        {
+            const auto &node = nodes[i];
+            const auto k = static_cast<int>(node.vertices.size());
+            REQUIRE_EQ(node.graph.numVertices(), k);
+            for (auto v : node.vertices)
+            {
+                if (tree.isMarker(v))
+                {
+                    CHECK_EQ(tree.nodeOfMarker(v), i);
+                    CHECK_EQ(tree.partner(tree.partner(v)), v);
+                    CHECK_NE(tree.nodeOfMarker(tree.partner(v)), i);
+                }
+                else
+                {
+                    CHECK_EQ(originalNode[v], -1);
+                    originalNode[v] = i;
+                }
+            }
+
+            cg::utils::SpinradPrime sp;
+            switch (node.type)
+            {
+            case SplitNodeType::Prime:
+                CHECK_FALSE(sp.trySplit(node.graph).has_value());
+                break;
+            case SplitNodeType::Clique:
+                CHECK_EQ(node.graph.numEdgeEnds(), static_cast<std::size_t>(k) * (k - 1));
+                break;
+            case SplitNodeType::Star:
+            {
+                const auto centre = static_cast<int>(std::find(node.vertices.begin(), node.vertices.end(), node.centre) - node.vertices.begin());
+                REQUIRE(centre < k);
+                CHECK_EQ(node.graph.degree(centre), k - 1);
+                CHECK_EQ(node.graph.numEdgeEnds(), 2 * static_cast<std::size_t>(k - 1));
+                break;
+            }
+            }
+
+            // Reduced: no clique next to a clique, no star centre joined to a leaf of another star.
+            for (auto v : node.vertices)
+            {
+                if (!tree.isMarker(v))
+                {
+                    continue;
+                }
+                const auto &other = nodes[tree.nodeOfMarker(tree.partner(v))];
+                CHECK_FALSE((node.type == SplitNodeType::Clique && other.type == SplitNodeType::Clique));
+                CHECK_FALSE((node.type == SplitNodeType::Star && other.type == SplitNodeType::Star && node.centre == v && other.centre != tree.partner(v)));
+            }
+        }
+
+        for (auto u = 0; u < graph.numVertices(); ++u)
+        {
+            REQUIRE_NE(originalNode[u], -1);
+            const auto neighbours = graph.neighbours(u);
+            CHECK_EQ(accessibleNeighbours(tree, originalNode[u], u), std::set<int>(neighbours.begin(), neighbours.end()));
+        }
+
+        const auto parallel = cg::utils::SplitDecomposition::decompose(graph, 3);
+        REQUIRE_EQ(parallel.nodes().size(), nodes.size());
+        for (std::size_t i = 0; i < nodes.size(); ++i)
+        {
+            CHECK_EQ(parallel.nodes()[i].vertices, nodes[i].vertices);
+        }
+    }
+
+    CsrGraph circleGraph(const std::vector<cg::data_structures::Interval> &intervals)
+    {
+        return CsrGraph::fromIntervalModel(cg::data_structures::DistinctIntervalModel(intervals));
+    }
+}
+
+TEST_CASE("[SplitDecomposition] Degenerate and prime graphs are a single node")
+{
+    for (auto n : {1, 2, 3, 6, 12})
+    {
+        CsrGraph::Builder clique(n);
+        CsrGraph::Builder star(n);
+        for (auto u = 0; u < n; ++u)
+        {
+            for (auto v = u + 1; v < n; ++v)
+            {
+                clique.addEdge(u, v);
+            }
+            if (u > 0)
+            {
+                star.addEdge(0, u);
+            }
+        }
+        const auto cliqueTree = cg::utils::SplitDecomposition::decompose(clique.build());
+        REQUIRE_EQ(cliqueTree.nodes().size(), 1);
+        CHECK(cliqueTree.nodes()[0].type == SplitNodeType::Clique);
+        if (n >= 3)
+        {
+            const auto starTree = cg::utils::SplitDecomposition::decompose(star.build());
+            REQUIRE_EQ(starTree.nodes().size(), 1);
+            CHECK(starTree.nodes()[0].type == SplitNodeType::Star);
+            CHECK_EQ(starTree.nodes()[0].centre, 0);
+        }
+    }
+
+    for (auto n : {5, 9})
+    {
+        CsrGraph::Builder cycle(n);
+        for (auto v = 0; v < n; ++v)
+        {
+            cycle.addEdge(v, (v + 1) % n);
+        }
+        const auto tree = cg::utils::SplitDecomposition::decompose(cycle.build());
+        REQUIRE_EQ(tree.nodes().size(), 1);
+        CHECK(tree.nodes()[0].type == SplitNodeType::Prime);
+    }
+
+    const auto nested = cg::utils::SplitDecomposition::decompose(circleGraph(cg::interval_model_utils::generatePrimeNestedIntervals(20)));
+    REQUIRE_EQ(nested.nodes().size(), 1);
+    CHECK(nested.nodes()[0].type == SplitNodeType::Prime);
+
+    CHECK_THROWS_AS(static_cast<void>(cg::utils::SplitDecomposition::decompose(CsrGraph::Builder(3).build())), std::invalid_argument);
+}
+
+TEST_CASE("[SplitDecomposition] A path is a chain of stars joined leaf to leaf")
+{
+    for (auto n : {4, 7, 15})
+    {
+        CsrGraph::Builder path(n);
+        for (auto v = 0; v + 1 < n; ++v)
+        {
+            path.addEdge(v, v + 1);
+        }
+        const auto graph = path.build();
+        const auto tree = cg::utils::SplitDecomposition::decompose(graph);
+        CHECK_EQ(static_cast<int>(tree.nodes().size()), n - 2);
+        for (const auto &node : tree.nodes())
+        {
+            CHECK(node.type == SplitNodeType::Star);
+        }
+        checkDecomposition(graph);
+    }
+}
+
+TEST_CASE("[SplitDecomposition] Trees of random circle graphs and random graphs give back the graph")
+{
+    std::mt19937 rng(2718);
+    for (auto trial = 0; trial < 25; ++trial)
+    {
+        const auto n = 4 + static_cast<int>(rng() % 40);
+        const cg::data_structures::DistinctIntervalModel model(cg::interval_model_utils::generateRandomIntervals(n, static_cast<int>(rng())));
+        const auto largest = cg::components::decompose(model).front();
+        checkDecomposition(CsrGraph::fromIntervalModel(largest.model));
+    }
+    for (auto layers : {2, 3, 5})
+    {
+        checkDecomposition(circleGraph(cg::interval_model_utils::generateLayeredHardCasePrime(layers)));
+    }
+    for (auto trial = 0; trial < 20; ++trial)
+    {
+        // A random tree plus a few extra edges: connected, with many splits.
+        const auto n = 2 + static_cast<int>(rng() % 30);
+        CsrGraph::Builder builder(n);
+        for (auto v = 1; v < n; ++v)
+        {
+            builder.addEdge(v, static_cast<int>(rng() % v));
+        }
+        for (auto e = static_cast<int>(rng() % (n + 1)); e > 0; --e)
+        {
+            const auto u = static_cast<int>(rng() % n);
+            const auto v = static_cast<int>(rng() % n);
+            if (u != v)
+            {
+                builder.addEdge(u, v);
+            }
+        }
+        checkDecomposition(builder.build());
+    }
+}
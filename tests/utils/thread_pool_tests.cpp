@@ -0,0 +1,93 @@
+#include "doctest/doctest.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "utils/thread_pool.h"
+
+TEST_CASE("[ThreadPool] parallelFor visits every index exactly once")
+{
+    for (auto threadCount : {1, 2, 5})
+    {
+        cg::utils::ThreadPool pool(threadCount);
+        CHECK_EQ(pool.threadCount(), threadCount);
+        for (auto count : {0, 1, 7, 1000})
+        {
+            std::vector<int> visits(count, 0);
+            pool.parallelFor(count, pool.chunkSizeFor(count), [&](int begin, int end)
+            {
+                for (auto i = begin; i < end; ++i)
+                {
+                    ++visits[i];
+                }
+            });
+            CHECK(std::ranges::all_of(visits, [](int v) { return v == 1; }));
+        }
+    }
+}
+
+TEST_CASE("[ThreadPool] Exceptions from a chunk reach the caller")
+{
+    cg::utils::ThreadPool pool(3);
+    CHECK_THROWS_AS(pool.parallelFor(100, 1, [](int begin, int)
+    {
+        if (begin == 42)
+        {
+            throw std::runtime_error("chunk failed");
+        }
+    }), std::runtime_error);
+
+    // The pool stays usable afterwards.
+    std::vector<int> visits(10, 0);
+    pool.parallelFor(10, 1, [&](int begin, int end)
+    {
+        for (auto i = begin; i < end; ++i)
+        {
+            ++visits[i];
+        }
+    });
+    CHECK(std::ranges::all_of(visits, [](int v) { return v == 1; }));
+}
+
+TEST_CASE("[ThreadPool] argMax keeps the first of equal maxima, like a serial scan")
+{
+    const std::vector<int> values{3, 9, 1, 9, 4, 9, 2, 0, 9, 5, 1, 7};
+    for (auto threadCount : {1, 2, 4})
+    {
+        cg::utils::ThreadPool pool(threadCount);
+        for (auto chunkSize : {1, 2, 5, 100})
+        {
+            const auto [best, index] = pool.argMax(static_cast<int>(values.size()), chunkSize, 0, -1, [&](int begin, int end, int best, int index)
+            {
+                for (auto i = begin; i < end; ++i)
+                {
+                    if (values[i] > best)
+                    {
+                        best = values[i];
+                        index = i;
+                    }
+                }
+                return std::pair{best, index};
+            });
+            CHECK_EQ(best, 9);
+            CHECK_EQ(index, 1);
+
+            const auto [unchanged, noIndex] = pool.argMax(static_cast<int>(values.size()), chunkSize, 100, -1, [&](int begin, int end, int best, int index)
+            {
+                for (auto i = begin; i < end; ++i)
+                {
+                    if (values[i] > best)
+                    {
+                        best = values[i];
+                        index = i;
+                    }
+                }
+                return std::pair{best, index};
+            });
+            CHECK_EQ(unchanged, 100);
+            CHECK_EQ(noIndex, -1);
+        }
+    }
+}